@@ -233,6 +233,31 @@ int msg_send(msg_t *m, kernel_pid_t target_pid);
 int msg_try_send(msg_t *m, kernel_pid_t target_pid);
 
 
+/**
+ * @brief Send a batch of messages (non-blocking).
+ *
+ * Delivers the messages in @p m to @p target_pid in one critical section: if
+ * the target is waiting in msg_receive(), the first message is handed over
+ * directly, all remaining ones are put into the target's message queue. The
+ * target is woken up only once for the whole batch, so a burst of messages
+ * costs one context switch instead of one per message. The caller only
+ * yields if the woken target has a higher priority.
+ *
+ * Delivery stops at the first message that does not fit into the target's
+ * queue, messages are never reordered. This function never blocks and may be
+ * called from an interrupt.
+ *
+ * @param[in] m             Array of @p num messages to send, must not be
+ *                          NULL. msg_t::sender_pid is set for every
+ *                          delivered message.
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered, starting from `m[0]`
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message to the current thread.
  * @details Will work only if the thread has a message queue.
@@ -310,6 +335,24 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive a batch of messages.
+ *
+ * Blocks until at least one message was received (just like msg_receive()),
+ * then drains up to @p num - 1 further messages from the thread's message
+ * queue in one critical section. Together with msg_send_batch() this allows
+ * handling a burst of messages with a single context switch.
+ *
+ * @pre     @p num > 0
+ *
+ * @param[out] m    Array of at least @p num preallocated ``msg_t``
+ *                  structures, must not be NULL.
+ * @param[in] num   Maximum number of messages to receive
+ *
+ * @return  number of messages received (at least 1)
+ */
+int msg_receive_batch(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
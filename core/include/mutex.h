@@ -91,6 +91,33 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ * With the (pseudo-)module `core_mutex_priority_inheritance` a thread holding
+ * a mutex inherits the priority of the threads waiting for it. This prevents a
+ * low priority thread holding a mutex from being preempted by medium priority
+ * threads, while a high priority thread waits for the mutex. With this module:
+ *
+ * - A mutex locked without waiters stores the PID of its owner instead of
+ *   `MUTEX_LOCKED` (`MUTEX_LOCKED` is a mutex locked by
+ *   `KERNEL_PID_UNDEF`, e.g. one initialized with @ref MUTEX_INIT_LOCKED).
+ * - Once a thread blocks on the mutex, the owner is moved to
+ *   `mutex_t::owner` and the mutex is added to the list of contended mutexes
+ *   held by the owner. If the waiting thread has a higher priority, the
+ *   priority of the owner is raised to it.
+ * - On unlocking, the mutex is removed from that list and the priority of
+ *   the owner is set to the highest of its base priority (the one it was
+ *   created with) and the priorities of the threads waiting for the mutexes
+ *   it still holds. The waiter with the highest priority becomes the new
+ *   owner.
+ * - On platforms with lock-free atomic pointer operations, locking an unlocked
+ *   mutex and unlocking a mutex without waiters by its owner is done with a
+ *   single compare-and-swap without disabling IRQs.
+ *
+ * The priority is only inherited by the direct owner, not by the owner of a
+ * mutex the owner in turn waits for. Contended mutexes may be released in any
+ * order.
  * @{
  *
  * @file
@@ -127,6 +154,21 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex, while threads are waiting for it
+     * @note    Only available with module `core_mutex_priority_inheritance`
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Entry in the list of mutexes held by the owner that threads
+     *          are waiting for
+     * @note    Only available with module `core_mutex_priority_inheritance`
+     * @internal
+     */
+    list_node_t owner_entry;
+#endif
 } mutex_t;
 
 /**
@@ -141,16 +183,21 @@ typedef struct {
     uint8_t cancelled;  /**< Flag whether the mutex has been cancelled */
 } mutex_cancel_t;
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, { NULL } }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, { NULL } }
+#else
+#define MUTEX_INIT { { NULL } }
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -158,6 +205,30 @@ typedef struct {
  *        for it
  */
 #define MUTEX_LOCKED ((list_node_t *)-1)
+
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+/**
+ * @brief This is the value of the mutex when locked by thread @p pid and no
+ *        threads are waiting for it
+ *
+ * The values are at the very end of the address space, where no thread can
+ * reside. `MUTEX_LOCKED_BY(KERNEL_PID_UNDEF)` equals @ref MUTEX_LOCKED.
+ */
+#define MUTEX_LOCKED_BY(pid) ((list_node_t *)(UINTPTR_MAX - (uintptr_t)(pid)))
+
+/**
+ * @brief Whether an uncontended mutex is locked and unlocked with a single
+ *        atomic compare-and-swap
+ */
+#if (__GCC_ATOMIC_POINTER_LOCK_FREE == 2) || defined(DOXYGEN)
+#define MUTEX_FAST_PATH     (1)
+#else
+#define MUTEX_FAST_PATH     (0)
+#endif
+#else
+#define MUTEX_LOCKED_BY(pid) MUTEX_LOCKED
+#define MUTEX_FAST_PATH     (0)
+#endif
 /**
  * @endcond
  */
@@ -205,7 +276,6 @@ static inline mutex_cancel_t mutex_cancel_init(mutex_t *mutex)
  *
  * @pre     @p mutex is not `NULL`
  * @pre     Mutex at @p mutex has been initialized
- * @pre     Must be called in thread context
  */
 int mutex_trylock_ffi(mutex_t *mutex);
 
@@ -219,7 +289,9 @@ int mutex_trylock_ffi(mutex_t *mutex);
  *
  * @pre     @p mutex is not `NULL`
  * @pre     Mutex at @p mutex has been initialized
- * @pre     Must be called in thread context
+ *
+ * @note    When called from interrupt context, the mutex is locked without
+ *          an owner, so that no thread inherits the priority of waiters.
  */
 static inline int mutex_trylock(mutex_t *mutex)
 {
@@ -230,7 +302,10 @@ static inline int mutex_trylock(mutex_t *mutex)
     int retval = 0;
 
     if (mutex->queue.next == NULL) {
-        mutex->queue.next = MUTEX_LOCKED;
+        /* an ISR must not make the interrupted thread the owner, as that
+         * thread would then inherit the priority of waiters */
+        mutex->queue.next = MUTEX_LOCKED_BY(irq_is_in() ? KERNEL_PID_UNDEF
+                                                        : thread_getpid());
         retval = 1;
     }
     irq_restore(irq_state);
@@ -198,6 +198,24 @@ thread_t *sched_run(void);
  */
 void sched_set_status(thread_t *process, thread_status_t status);
 
+/**
+ * @brief   Change the priority of the specified thread
+ *
+ * A thread on the runqueue is moved to the runqueue of its new priority. The
+ * position of a blocked thread in wait queues (e.g. of a mutex) is not
+ * updated.
+ *
+ * @pre     IRQs are disabled
+ *
+ * @note    This function does not yield. Call @ref sched_switch or
+ *          @ref thread_yield_higher afterwards, if the change may require a
+ *          context switch.
+ *
+ * @param[in,out]   thread      The thread to change the priority of
+ * @param[in]       priority    The new priority
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief       Yield if appropriate.
  *
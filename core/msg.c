@@ -33,6 +33,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace_event.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -101,6 +102,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    TRACE_EVENT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -176,11 +179,83 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
     return 1;
 }
 
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned sent = 0;
+
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("%s: target_pid is invalid, continuing anyways\n", __func__);
+    }
+#endif /* DEVELHELP */
+
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        return -1;
+    }
+
+    if (num > 0) {
+        TRACE_EVENT(TRACE_EVENT_MSG_SEND, target_pid, m[0].type);
+    }
+
+    unsigned state = irq_disable();
+    int woken = 0;
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        /* target's queue is empty, otherwise it would not be waiting */
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = 1;
+        sent++;
+    }
+
+    unsigned direct = sent;
+
+    for (; sent < num; sent++) {
+        int n = cib_put(&(target->msg_queue));
+
+        if (n < 0) {
+            DEBUG("%s: message queue is full (or there is none)\n", __func__);
+            break;
+        }
+        m[sent].sender_pid = sender_pid;
+        target->msg_array[n] = m[sent];
+    }
+
+#if MODULE_CORE_THREAD_FLAGS
+    /* like queue_msg(), only signal messages that went to the queue */
+    if (sent > direct) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        woken |= thread_flags_wake(target);
+    }
+#else
+    (void)direct;
+#endif
+
+    uint16_t target_prio = target->priority;
+    irq_restore(state);
+    /* switch only if the woken target has a higher priority than the sender
+     * (or the interrupted thread) */
+    if (woken) {
+        sched_switch(target_prio);
+    }
+
+    return sent;
+}
+
 int msg_send_to_self(msg_t *m)
 {
     unsigned state = irq_disable();
 
     m->sender_pid = thread_getpid();
+    TRACE_EVENT(TRACE_EVENT_MSG_SEND, m->sender_pid, m->type);
     int res = queue_msg(thread_get_active(), m);
 
     irq_restore(state);
@@ -202,6 +277,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    TRACE_EVENT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -331,12 +408,49 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        TRACE_EVENT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    TRACE_EVENT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    return res;
+}
+
+int msg_receive_batch(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    unsigned received = _msg_receive(m, 1);
+
+    TRACE_EVENT(TRACE_EVENT_MSG_RECV, m[0].sender_pid, m[0].type);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+
+    /* drain whatever else got queued while we were waiting, blocked senders
+     * are left to subsequent calls so they are woken up one at a time */
+    if (thread_has_msg_queue(me)) {
+        for (; received < num; received++) {
+            int queue_index = cib_get(&(me->msg_queue));
+
+            if (queue_index < 0) {
+                break;
+            }
+            m[received] = me->msg_array[queue_index];
+        }
+    }
+
+    irq_restore(state);
+
+    return received;
 }
 
 static int _msg_receive(msg_t *m, int block)
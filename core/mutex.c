@@ -22,6 +22,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "mutex.h"
@@ -33,6 +34,142 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/* true if the mutex is locked, but no thread is waiting for it */
+static inline bool _locked_idle(const mutex_t *mutex)
+{
+    return (uintptr_t)mutex->queue.next >=
+           (uintptr_t)MUTEX_LOCKED_BY(KERNEL_PID_LAST);
+}
+
+/* PID of the owner of a mutex locked without waiters */
+static inline kernel_pid_t _idle_owner(const mutex_t *mutex)
+{
+    return UINTPTR_MAX - (uintptr_t)mutex->queue.next;
+}
+
+/* make @p pid the owner of a mutex threads are waiting for */
+static inline void _set_owner(mutex_t *mutex, kernel_pid_t pid)
+{
+    thread_t *owner = thread_get(pid);
+
+    mutex->owner = pid;
+    if (owner != NULL) {
+        list_add(&owner->held_mutexes, &mutex->owner_entry);
+    }
+}
+
+/* raise the priority of the owner to @p priority, if it is lower */
+static inline void _inherit_priority(mutex_t *mutex, uint8_t priority)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if ((owner != NULL) && (owner->priority > priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): raising priority of "
+              "owner %" PRIkernel_pid " from %u to %u\n", thread_getpid(),
+              owner->pid, (unsigned)owner->priority, (unsigned)priority);
+        sched_change_priority(owner, priority);
+    }
+}
+
+/* set the priority of @p owner to the highest of its base priority and the
+ * priorities of the threads waiting for the mutexes it holds */
+static void _update_priority(thread_t *owner)
+{
+    uint8_t priority = owner->base_priority;
+
+    for (list_node_t *node = owner->held_mutexes.next; node; node = node->next) {
+        mutex_t *mutex = container_of(node, mutex_t, owner_entry);
+        /* the queue is sorted by priority */
+        thread_t *waiter = container_of((clist_node_t *)mutex->queue.next,
+                                        thread_t, rq_entry);
+
+        if (waiter->priority < priority) {
+            priority = waiter->priority;
+        }
+    }
+
+    if (owner->priority != priority) {
+        DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): changing priority of "
+              "owner %" PRIkernel_pid " from %u to %u\n", thread_getpid(),
+              owner->pid, (unsigned)owner->priority, (unsigned)priority);
+        sched_change_priority(owner, priority);
+    }
+}
+
+/* remove the mutex from the ones its owner holds with threads waiting */
+static inline void _release_owner(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (owner != NULL) {
+        list_remove(&owner->held_mutexes, &mutex->owner_entry);
+        _update_priority(owner);
+    }
+}
+
+/* update the mutex after @p process was removed from its waiters and got it */
+static inline void _hand_over(mutex_t *mutex, thread_t *process)
+{
+    _release_owner(mutex);
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED_BY(process->pid);
+    }
+    else {
+        /* the remaining waiters have at most the priority of process */
+        _set_owner(mutex, process->pid);
+    }
+}
+#else
+static inline bool _locked_idle(const mutex_t *mutex)
+{
+    return mutex->queue.next == MUTEX_LOCKED;
+}
+
+static inline void _hand_over(mutex_t *mutex, thread_t *process)
+{
+    (void)process;
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+}
+#endif
+
+#if MUTEX_FAST_PATH
+/* lock an unlocked mutex without disabling IRQs */
+static inline bool _try_lock_fast(mutex_t *mutex)
+{
+    list_node_t *expected = NULL;
+
+    return __atomic_compare_exchange_n(&mutex->queue.next, &expected,
+                                       MUTEX_LOCKED_BY(thread_getpid()), false,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+/* unlock a mutex held by the running thread without waiters without
+ * disabling IRQs */
+static inline bool _try_unlock_fast(mutex_t *mutex)
+{
+    list_node_t *expected = MUTEX_LOCKED_BY(thread_getpid());
+
+    return __atomic_compare_exchange_n(&mutex->queue.next, &expected, NULL,
+                                       false, __ATOMIC_RELEASE,
+                                       __ATOMIC_RELAXED);
+}
+#else
+static inline bool _try_lock_fast(mutex_t *mutex)
+{
+    (void)mutex;
+    return false;
+}
+
+static inline bool _try_unlock_fast(mutex_t *mutex)
+{
+    (void)mutex;
+    return false;
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -51,13 +188,20 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex, unsigne
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
-    if (mutex->queue.next == MUTEX_LOCKED) {
+    if (_locked_idle(mutex)) {
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        /* the queue is needed for the waiters now */
+        _set_owner(mutex, _idle_owner(mutex));
+#endif
         mutex->queue.next = (list_node_t *)&me->rq_entry;
         mutex->queue.next->next = NULL;
     }
     else {
         thread_add_to_list(&mutex->queue, me);
     }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    _inherit_priority(mutex, me->priority);
+#endif
 
     irq_restore(irq_state);
     thread_yield_higher();
@@ -66,13 +210,17 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex, unsigne
 
 void mutex_lock(mutex_t *mutex)
 {
+    if (_try_lock_fast(mutex)) {
+        return;
+    }
+
     unsigned irq_state = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock().\n", thread_getpid());
 
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
-        mutex->queue.next = MUTEX_LOCKED;
+        mutex->queue.next = MUTEX_LOCKED_BY(thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -99,7 +247,7 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     mutex_t *mutex = mc->mutex;
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
-        mutex->queue.next = MUTEX_LOCKED;
+        mutex->queue.next = MUTEX_LOCKED_BY(thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -117,6 +265,10 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
 
 void mutex_unlock(mutex_t *mutex)
 {
+    if (_try_unlock_fast(mutex)) {
+        return;
+    }
+
     unsigned irqstate = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): queue.next: %p\n",
@@ -128,7 +280,7 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    if (mutex->queue.next == MUTEX_LOCKED) {
+    if (_locked_idle(mutex)) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
@@ -142,10 +294,7 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
     sched_set_status(process, STATUS_PENDING);
-
-    if (!mutex->queue.next) {
-        mutex->queue.next = MUTEX_LOCKED;
-    }
+    _hand_over(mutex, process);
 
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
@@ -159,7 +308,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
-        if (mutex->queue.next == MUTEX_LOCKED) {
+        if (_locked_idle(mutex)) {
             mutex->queue.next = NULL;
         }
         else {
@@ -169,9 +318,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
-            if (!mutex->queue.next) {
-                mutex->queue.next = MUTEX_LOCKED;
-            }
+            _hand_over(mutex, process);
         }
     }
 
@@ -196,13 +343,30 @@ void mutex_cancel(mutex_cancel_t *mc)
         return;
     }
 
-    if ((mutex->queue.next != MUTEX_LOCKED)
+    if (!_locked_idle(mutex)
             && (mutex->queue.next != NULL)
             && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
         /* Thread was queued and removed from list, wake it up */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        thread_t *owner = thread_get(mutex->owner);
+
+        if (mutex->queue.next == NULL) {
+            /* no thread left to inherit the priority from */
+            if (owner != NULL) {
+                list_remove(&owner->held_mutexes, &mutex->owner_entry);
+            }
+            mutex->queue.next = MUTEX_LOCKED_BY(mutex->owner);
+        }
+        if (owner != NULL) {
+            /* the cancelled thread may have been the one with the highest
+             * priority */
+            _update_priority(owner);
+        }
+#else
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
         }
+#endif
         sched_set_status(thread, STATUS_PENDING);
         irq_restore(irq_state);
         sched_switch(thread->priority);
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdint.h>
 #include <inttypes.h>
 
@@ -238,6 +239,27 @@ void sched_set_status(thread_t *process, thread_status_t status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert((thread != NULL) && (priority < SCHED_PRIO_LEVELS));
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid " from %" PRIu8
+          " to %" PRIu8 ".\n", thread->pid, thread->priority, priority);
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            _clear_runqueue_bit(thread);
+        }
+        thread->priority = priority;
+        clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        _set_runqueue_bit(thread);
+    }
+    else {
+        thread->priority = priority;
+    }
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = thread_get_active();
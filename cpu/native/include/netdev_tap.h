@@ -25,8 +25,10 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "cib.h"
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #ifdef __MACH__
@@ -35,6 +37,19 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Number of frames buffered by the `netdev_tap_batch` module
+ *
+ * With `netdev_tap_batch`, all frames pending at the tap interface are read
+ * at once when it signals new data, up to this number. This way their exact
+ * size is known before the upper layer allocates a buffer for them.
+ *
+ * @note    Must be a power of 2
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH
+#define CONFIG_NETDEV_TAP_RX_BATCH  (8U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +59,17 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscuous;                 /**< Flag for promiscuous mode */
+#if defined(MODULE_NETDEV_TAP_BATCH) || defined(DOXYGEN)
+    cib_t rx_cib;                       /**< index of the frames in rx_buf */
+    /**
+     * @brief   Sizes of the frames in @ref netdev_tap_t::rx_buf
+     */
+    uint16_t rx_len[CONFIG_NETDEV_TAP_RX_BATCH];
+    /**
+     * @brief   Frames read from the tap interface, but not received yet
+     */
+    uint8_t rx_buf[CONFIG_NETDEV_TAP_RX_BATCH][ETHERNET_FRAME_LEN];
+#endif
 } netdev_tap_t;
 
 /**
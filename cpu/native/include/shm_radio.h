@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_shm_radio   Shared memory radio
+ * @ingroup     drivers_netdev
+ * @brief       IEEE 802.15.4 device simulating a broadcast medium in shared
+ *              memory
+ *
+ * This device allows for simulating large numbers of RIOT native instances
+ * on a single Linux host, without sending every frame through the host's
+ * network stack as e.g. @ref drivers_socket_zep does.
+ *
+ * All instances attached to the same medium share a ring of frames in a
+ * memory-mapped file, by default in `/dev/shm`. Sending a frame copies it
+ * into the ring and wakes up all receivers with a single futex call. Each device
+ * watches the medium in a helper process and is notified once for all frames
+ * that were sent while it was busy. All frames on the same channel are
+ * received by all other devices on the medium (as far as the destination
+ * address matches), but:
+ *
+ * - frames can be dropped randomly with a configurable probability
+ *   (@ref shm_radio_params_t::loss) and
+ * - frames can be delayed by a configurable latency
+ *   (@ref shm_radio_params_t::latency).
+ *
+ * A device not keeping up with the medium for more than
+ * @ref CONFIG_SHM_RADIO_RING_SIZE frames loses the overwritten frames. A frame
+ * whose sender did not finish writing it within
+ * @ref CONFIG_SHM_RADIO_STALL_TIMEOUT_US, e.g. because it was killed, is
+ * skipped. In promiscuous mode (@ref NETOPT_PROMISCUOUSMODE), all frames on
+ * the channel are received regardless of their destination address.
+ *
+ * The medium is selected with the `-r`/`--shm-radio` command line option:
+ *
+ *     -r <file>[,<loss in %>[,<latency in us>]]
+ *
+ * @note    Only available on Linux, as futexes are used for wake-ups.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Shared memory radio definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef SHM_RADIO_H
+#define SHM_RADIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "net/ieee802154.h"
+#include "net/netdev.h"
+#include "net/netdev/ieee802154.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of frames the medium keeps
+ *
+ * @note    Must be a power of 2 and the same for all instances sharing a
+ *          medium
+ */
+#ifndef CONFIG_SHM_RADIO_RING_SIZE
+#define CONFIG_SHM_RADIO_RING_SIZE      (256U)
+#endif
+
+/**
+ * @brief   Time in microseconds after which a frame still being written is
+ *          skipped
+ *
+ * Protects receivers and senders from a sender that died while writing a
+ * frame.
+ */
+#ifndef CONFIG_SHM_RADIO_STALL_TIMEOUT_US
+#define CONFIG_SHM_RADIO_STALL_TIMEOUT_US   (100000U)
+#endif
+
+/**
+ * @brief   File of the medium used, if none is given on the command line
+ */
+#ifndef CONFIG_SHM_RADIO_DEFAULT_MEDIUM
+#define CONFIG_SHM_RADIO_DEFAULT_MEDIUM "/dev/shm/riot_shm_radio"
+#endif
+
+/**
+ * @brief   Shared memory medium
+ *
+ * @internal
+ */
+typedef struct shm_radio_medium shm_radio_medium_t;
+
+/**
+ * @brief   Shared memory radio device state
+ */
+typedef struct {
+    netdev_ieee802154_t netdev;     /**< netdev internal member */
+    shm_radio_medium_t *medium;     /**< the medium in shared memory */
+    xtimer_t timer;                 /**< timer for delayed or stalled
+                                     *   frames */
+    uint64_t stall_since;           /**< time the next frame was first found
+                                     *   unfinished, 0 if it was not */
+    uint32_t id;                    /**< identifies frames sent by the device */
+    uint32_t next;                  /**< next frame to receive from the medium */
+    uint32_t latency;               /**< latency of frames in microseconds */
+    uint8_t loss;                   /**< probability of frame loss in percent */
+    bool promiscuous;               /**< receive frames to any destination */
+    int notify_fd;                  /**< read end of the notification pipe */
+    pid_t notify_pid;               /**< helper process watching the medium */
+    netdev_event_t last_event;      /**< event triggered */
+    uint8_t rx_len;                 /**< length of the frame in rx_buf */
+    /**
+     * @brief   Received frame (PSDU without FCS)
+     */
+    uint8_t rx_buf[IEEE802154_FRAME_LEN_MAX];
+} shm_radio_t;
+
+/**
+ * @brief   Shared memory radio initialization parameters
+ */
+typedef struct {
+    char *medium;       /**< file of the medium, NULL for
+                         *   @ref CONFIG_SHM_RADIO_DEFAULT_MEDIUM */
+    uint32_t latency;   /**< latency of received frames in microseconds */
+    uint8_t loss;       /**< probability of frame loss in percent */
+} shm_radio_params_t;
+
+/**
+ * @brief   Setup shm_radio_t structure and attach to the medium
+ *
+ * The addresses of the device are derived from an identifier unique on the
+ * medium.
+ *
+ * @param[in] dev       the preallocated shm_radio_t device handle to setup
+ * @param[in] params    initialization parameters
+ */
+void shm_radio_setup(shm_radio_t *dev, const shm_radio_params_t *params);
+
+/**
+ * @brief   Detach from the medium
+ *
+ * @param dev  the shm_radio device handle to cleanup
+ */
+void shm_radio_cleanup(shm_radio_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHM_RADIO_H */
+/** @} */
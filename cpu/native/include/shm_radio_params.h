@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_shm_radio
+ * @{
+ *
+ * @file
+ * @brief       Configuration parameters for the @ref drivers_shm_radio
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef SHM_RADIO_PARAMS_H
+#define SHM_RADIO_PARAMS_H
+
+#include "shm_radio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of allocated parameters at @ref shm_radio_params
+ *
+ * @note    This was decided to only be configurable on compile-time to be
+ *          more similar to actual boards
+ */
+#ifndef SHM_RADIO_MAX
+#define SHM_RADIO_MAX               (1)
+#endif
+
+/**
+ * @brief   shm_radio configurations
+ */
+extern shm_radio_params_t shm_radio_params[SHM_RADIO_MAX];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHM_RADIO_PARAMS_H */
+/** @} */
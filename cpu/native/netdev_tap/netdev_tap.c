@@ -53,6 +53,7 @@
 #include "async_read.h"
 
 #include "iolist.h"
+#include "kernel_defines.h"
 #include "net/eui64.h"
 #include "net/netdev.h"
 #include "net/netdev/eth.h"
@@ -94,10 +95,42 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+static bool _read_batch(netdev_tap_t *dev);
+static void _continue_reading(netdev_tap_t *dev);
+#endif
+
 static inline void _isr(netdev_t *netdev)
 {
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    bool done;
+
+    /* SIGIO is only raised for new frames, so read until the tap is empty
+     * or the upper layer stops receiving */
+    do {
+        done = _read_batch(dev);
+        if (netdev->event_callback == NULL) {
+            break;
+        }
+        while (cib_avail(&dev->rx_cib) > 0) {
+            unsigned avail = cib_avail(&dev->rx_cib);
+
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            if (cib_avail(&dev->rx_cib) == avail) {
+                /* upper layer did not receive the frame, keep it */
+                done = true;
+                break;
+            }
+        }
+    } while (!done);
+    /* re-posts the interrupt, if frames are still left in the tap */
+    _continue_reading(dev);
+#endif
     if (netdev->event_callback) {
+#if !IS_USED(MODULE_NETDEV_TAP_BATCH)
         netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+#endif
     }
 #if DEVELHELP
     else {
@@ -165,13 +198,13 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
@@ -204,6 +237,81 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
+static bool _is_for_me(netdev_tap_t *dev, const ethernet_hdr_t *hdr)
+{
+    if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
+        !_is_addr_broadcast(hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+/* reads frames into the free slots of the ring, returns true if the tap is
+ * empty */
+static bool _read_batch(netdev_tap_t *dev)
+{
+    /* a slot is only added to the ring after a frame for us was read into
+     * it */
+    while (!cib_full(&dev->rx_cib)) {
+        unsigned idx = dev->rx_cib.write_count & dev->rx_cib.mask;
+        int nread = real_read(dev->tap_fd, dev->rx_buf[idx],
+                              sizeof(dev->rx_buf[idx]));
+
+        DEBUG("netdev_tap: read %d bytes\n", nread);
+        if (nread > 0) {
+            if (_is_for_me(dev, (ethernet_hdr_t *)dev->rx_buf[idx])) {
+                dev->rx_len[idx] = nread;
+                cib_put(&dev->rx_cib);
+            }
+        }
+        else if (nread == -1) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                err(EXIT_FAILURE, "netdev_tap: read");
+            }
+            return true;
+        }
+        else {
+            DEBUG("_native_handle_tap_input: ignoring null-event\n");
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    int idx = cib_peek(&dev->rx_cib);
+    int size;
+    (void)info;
+
+    if (idx < 0) {
+        return 0;
+    }
+    size = dev->rx_len[idx];
+    if (!buf) {
+        if (len > 0) {
+            /* no memory available in pktbuf, discarding the frame */
+            DEBUG("netdev_tap: discarding the frame\n");
+            cib_get(&dev->rx_cib);
+        }
+        return size;
+    }
+    cib_get(&dev->rx_cib);
+    if ((size_t)size > len) {
+        DEBUG("netdev_tap: buffer too small, discarding the frame\n");
+        return -ENOBUFS;
+    }
+    memcpy(buf, dev->rx_buf[idx], size);
+    return size;
+}
+#else   /* IS_USED(MODULE_NETDEV_TAP_BATCH) */
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
@@ -238,15 +346,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
-
+        if (!_is_for_me(dev, (ethernet_hdr_t *)buf)) {
             native_async_read_continue(dev->tap_fd);
 
             return 0;
@@ -272,6 +372,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
     return -1;
 }
+#endif  /* IS_USED(MODULE_NETDEV_TAP_BATCH) */
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
@@ -333,6 +434,9 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+    cib_init(&dev->rx_cib, CONFIG_NETDEV_TAP_RX_BATCH);
+#endif
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
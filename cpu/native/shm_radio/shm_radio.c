@@ -0,0 +1,529 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+#ifndef __linux__
+#error "shm_radio requires futexes, which are only available on Linux"
+#endif
+#include <linux/futex.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+
+#include "async_read.h"
+#include "byteorder.h"
+#include "iolist.h"
+#include "native_internal.h"
+#include "random.h"
+
+#include "shm_radio.h"
+
+#define ENABLE_DEBUG            0
+#include "debug.h"
+
+#define SHM_RADIO_MAGIC         (0x52494f54U)   /* "RIOT" */
+#define SHM_RADIO_VERSION       (2U)
+#define RING_MASK               (CONFIG_SHM_RADIO_RING_SIZE - 1)
+
+#if (CONFIG_SHM_RADIO_RING_SIZE & RING_MASK) != 0
+#error "CONFIG_SHM_RADIO_RING_SIZE must be a power of 2"
+#endif
+
+/* frame slot in the medium, protected by a sequence lock */
+typedef struct {
+    uint32_t lock;          /* odd while a sender writes the slot */
+    uint32_t seq;           /* number of the frame in the slot + 1 */
+    uint64_t time;          /* time the frame was sent in microseconds */
+    uint32_t sender;        /* ID of the sending device */
+    uint8_t chan;           /* channel the frame was sent on */
+    uint8_t len;            /* length of the PSDU without FCS */
+    uint8_t psdu[IEEE802154_FRAME_LEN_MAX];
+} _frame_t;
+
+/* all members are zero in a new medium */
+struct shm_radio_medium {
+    uint32_t magic;         /* SHM_RADIO_MAGIC, once initialized */
+    uint32_t version;       /* SHM_RADIO_VERSION */
+    uint32_t ring_size;     /* CONFIG_SHM_RADIO_RING_SIZE */
+    uint32_t last_id;       /* ID of the device attached last */
+    uint32_t head;          /* number of frames reserved by senders */
+    uint32_t committed;     /* futex, number of frames written */
+    uint32_t waiters;       /* number of helpers waiting on committed */
+    _frame_t ring[CONFIG_SHM_RADIO_RING_SIZE];
+};
+
+static uint64_t _now_us(void)
+{
+    struct timeval tv;
+
+    real_gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * US_PER_SEC) + tv.tv_usec;
+}
+
+/* waits for other senders, that got the same slot after the ring wrapped
+ * around, and returns the odd lock value owned by the caller */
+static uint32_t _slot_lock(_frame_t *frame)
+{
+    uint32_t lock = __atomic_load_n(&frame->lock, __ATOMIC_RELAXED);
+    uint64_t since = 0;
+
+    while (1) {
+        if ((lock & 1) == 0) {
+            if (__atomic_compare_exchange_n(&frame->lock, &lock, lock + 1,
+                                            false, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                lock += 1;
+                break;
+            }
+            continue;
+        }
+        if (since == 0) {
+            since = _now_us();
+        }
+        else if ((_now_us() - since) > CONFIG_SHM_RADIO_STALL_TIMEOUT_US) {
+            /* take over from a stalled sender, the lock stays odd */
+            if (__atomic_compare_exchange_n(&frame->lock, &lock, lock + 2,
+                                            false, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                lock += 2;
+                break;
+            }
+            continue;
+        }
+        lock = __atomic_load_n(&frame->lock, __ATOMIC_RELAXED);
+    }
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return lock;
+}
+
+static void _slot_unlock(_frame_t *frame, uint32_t lock)
+{
+    /* fails if the slot was taken over, the frame is then lost */
+    __atomic_compare_exchange_n(&frame->lock, &lock, lock + 1, false,
+                                __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+static inline bool _dst_not_me(shm_radio_t *dev, const void *buf)
+{
+    uint8_t dst_addr[IEEE802154_LONG_ADDRESS_LEN] = { 0 };
+    int dst_len;
+    le_uint16_t dst_pan = { .u16 = 0 };
+
+    dst_len = ieee802154_get_dst(buf, dst_addr,
+                                 &dst_pan);
+    switch (dst_len) {
+        case IEEE802154_LONG_ADDRESS_LEN:
+            return memcmp(dst_addr, dev->netdev.long_addr, dst_len) != 0;
+        case IEEE802154_SHORT_ADDRESS_LEN:
+            return (memcmp(dst_addr, ieee802154_addr_bcast, dst_len) != 0) &&
+                   (memcmp(dst_addr, dev->netdev.short_addr, dst_len) != 0);
+        default:
+            return false;    /* better safe than sorry ;-) */
+    }
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+    shm_radio_medium_t *medium = dev->medium;
+    size_t len = iolist_size(iolist);
+    _frame_t *frame;
+    uint32_t n, lock;
+
+    assert(medium != NULL);
+    if (len > (IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN)) {
+        return -EOVERFLOW;
+    }
+    DEBUG("shm_radio::send(%p, %p, %u)\n", (void *)netdev, (void *)iolist,
+          (unsigned)len);
+    /* simulate TX_STARTED interrupt */
+    if (netdev->event_callback) {
+        dev->last_event = NETDEV_EVENT_TX_STARTED;
+        netdev_trigger_event_isr(netdev);
+        thread_yield();
+    }
+
+    n = __atomic_fetch_add(&medium->head, 1, __ATOMIC_SEQ_CST);
+    frame = &medium->ring[n & RING_MASK];
+    lock = _slot_lock(frame);
+    __atomic_store_n(&frame->seq, n + 1, __ATOMIC_RELAXED);
+    frame->time = _now_us();
+    frame->sender = dev->id;
+    frame->chan = dev->netdev.chan;
+    frame->len = len;
+    for (uint8_t *ptr = frame->psdu; iolist; iolist = iolist->iol_next) {
+        memcpy(ptr, iolist->iol_base, iolist->iol_len);
+        ptr += iolist->iol_len;
+    }
+    _slot_unlock(frame, lock);
+
+    /* wake up all receivers at once */
+    __atomic_fetch_add(&medium->committed, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&medium->waiters, __ATOMIC_SEQ_CST) > 0) {
+        _native_in_syscall++;
+        syscall(SYS_futex, &medium->committed, FUTEX_WAKE, INT_MAX,
+                NULL, NULL, 0);
+        _native_in_syscall--;
+    }
+
+    /* simulate TX_COMPLETE interrupt */
+    if (netdev->event_callback) {
+        dev->last_event = NETDEV_EVENT_TX_COMPLETE;
+        netdev_trigger_event_isr(netdev);
+        thread_yield();
+    }
+
+    return len;
+}
+
+/* returns true, if the sender of the next frame took too long to write it,
+ * otherwise checks again later */
+static bool _stalled(shm_radio_t *dev)
+{
+    uint64_t now = _now_us();
+
+    if (dev->stall_since == 0) {
+        dev->stall_since = now;
+    }
+    else if ((now - dev->stall_since) > CONFIG_SHM_RADIO_STALL_TIMEOUT_US) {
+        DEBUG("shm_radio: skipping stalled frame %" PRIu32 "\n", dev->next);
+        dev->stall_since = 0;
+        return true;
+    }
+    /* the sender notifies once the frame is written, unless it died */
+    xtimer_set(&dev->timer, CONFIG_SHM_RADIO_STALL_TIMEOUT_US);
+    return false;
+}
+
+/* copies the next frame for the device from the medium to rx_buf, returns
+ * false if there is none (yet) */
+static bool _fetch(shm_radio_t *dev)
+{
+    shm_radio_medium_t *medium = dev->medium;
+
+    while (dev->next != __atomic_load_n(&medium->head, __ATOMIC_SEQ_CST)) {
+        _frame_t *frame = &medium->ring[dev->next & RING_MASK];
+        uint32_t seq = dev->next + 1;
+        uint32_t lock, frame_seq, sender;
+        uint64_t time;
+        uint8_t chan, len;
+
+        lock = __atomic_load_n(&frame->lock, __ATOMIC_ACQUIRE);
+        frame_seq = __atomic_load_n(&frame->seq, __ATOMIC_RELAXED);
+        if (((lock & 1) != 0) || ((int32_t)(frame_seq - seq) < 0)) {
+            /* slot being written or reserved, but writing not started yet */
+            if (_stalled(dev)) {
+                dev->next++;
+                continue;
+            }
+            return false;
+        }
+        dev->stall_since = 0;
+        time = frame->time;
+        sender = frame->sender;
+        chan = frame->chan;
+        len = frame->len;
+        if (len > sizeof(dev->rx_buf)) {
+            len = sizeof(dev->rx_buf);
+        }
+        memcpy(dev->rx_buf, frame->psdu, len);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&frame->lock, __ATOMIC_RELAXED) != lock) {
+            /* overwritten during the copy, check the slot again */
+            continue;
+        }
+        if (frame_seq != seq) {
+            DEBUG("shm_radio: lost frame %" PRIu32 "\n", seq - 1);
+            dev->next++;
+            continue;
+        }
+        if (dev->latency > 0) {
+            uint64_t now = _now_us();
+
+            if ((time + dev->latency) > now) {
+                xtimer_set(&dev->timer, (time + dev->latency) - now);
+                return false;
+            }
+        }
+        dev->next++;
+        if ((sender == dev->id) || (chan != dev->netdev.chan) ||
+            (!dev->promiscuous && _dst_not_me(dev, dev->rx_buf))) {
+            continue;
+        }
+        if ((dev->loss > 0) && (random_uint32_range(0, 100) < dev->loss)) {
+            DEBUG("shm_radio: dropping frame %" PRIu32 "\n", seq - 1);
+            continue;
+        }
+        dev->rx_len = len;
+        return true;
+    }
+    return false;
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+    int size = dev->rx_len;
+
+    DEBUG("shm_radio::recv(%p, %p, %u, %p)\n", (void *)netdev, buf,
+          (unsigned)len, (void *)info);
+    if (buf == NULL) {
+        if (len > 0) {
+            /* drop frame */
+            dev->rx_len = 0;
+        }
+        return size;
+    }
+    dev->rx_len = 0;
+    if ((size_t)size > len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, dev->rx_buf, size);
+    if (info != NULL) {
+        struct netdev_radio_rx_info *rx_info = info;
+        rx_info->lqi = UINT8_MAX;
+        rx_info->rssi = UINT8_MAX;
+    }
+    return size;
+}
+
+static void _isr(netdev_t *netdev)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+    netdev_event_t event = dev->last_event;
+    uint8_t tmp[16];
+
+    dev->last_event = NETDEV_EVENT_RX_COMPLETE;
+    if (netdev->event_callback == NULL) {
+        return;
+    }
+    if (event != NETDEV_EVENT_RX_COMPLETE) {
+        DEBUG("shm_radio::isr: firing %u\n", (unsigned)event);
+        netdev->event_callback(netdev, event);
+    }
+    /* one notification covers all frames written so far */
+    while (real_read(dev->notify_fd, tmp, sizeof(tmp)) > 0) {}
+    native_async_read_continue(dev->notify_fd);
+    while (_fetch(dev)) {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        /* drop the frame, if it was not received */
+        dev->rx_len = 0;
+    }
+}
+
+static void _notify_isr(int fd, void *arg)
+{
+    netdev_t *netdev = arg;
+
+    (void)fd;
+    if (netdev->event_callback) {
+        netdev_trigger_event_isr(netdev);
+    }
+}
+
+static void _timer_cb(void *arg)
+{
+    netdev_t *netdev = arg;
+
+    if (netdev->event_callback) {
+        netdev_trigger_event_isr(netdev);
+    }
+}
+
+static int _init(netdev_t *netdev)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+
+    assert(dev != NULL);
+    netdev_ieee802154_reset(&dev->netdev);
+    dev->netdev.chan = CONFIG_IEEE802154_DEFAULT_CHANNEL;
+
+    return 0;
+}
+
+static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+
+    assert(netdev != NULL);
+    if (opt == NETOPT_PROMISCUOUSMODE) {
+        assert(max_len >= sizeof(netopt_enable_t));
+        *((netopt_enable_t *)value) = (dev->promiscuous) ? NETOPT_ENABLE
+                                                         : NETOPT_DISABLE;
+        return sizeof(netopt_enable_t);
+    }
+    return netdev_ieee802154_get((netdev_ieee802154_t *)netdev, opt, value, max_len);
+}
+
+static int _set(netdev_t *netdev, netopt_t opt, const void *value,
+                size_t value_len)
+{
+    shm_radio_t *dev = (shm_radio_t *)netdev;
+
+    assert(netdev != NULL);
+    if (opt == NETOPT_PROMISCUOUSMODE) {
+        assert(value_len >= sizeof(netopt_enable_t));
+        dev->promiscuous = (*((const netopt_enable_t *)value) == NETOPT_ENABLE);
+        return sizeof(netopt_enable_t);
+    }
+    return netdev_ieee802154_set((netdev_ieee802154_t *)netdev, opt,
+                                  value, value_len);
+}
+
+static const netdev_driver_t shm_radio_driver = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static shm_radio_medium_t *_attach(const char *file)
+{
+    shm_radio_medium_t *medium;
+    uint32_t magic = 0;
+    int fd;
+
+    if ((fd = real_open(file, O_RDWR | O_CREAT, 0600)) < 0) {
+        err(EXIT_FAILURE, "shm_radio: unable to open %s", file);
+    }
+    /* extending the file by multiple instances at once is harmless */
+    if (ftruncate(fd, sizeof(shm_radio_medium_t)) < 0) {
+        err(EXIT_FAILURE, "shm_radio: unable to resize %s", file);
+    }
+    medium = mmap(NULL, sizeof(shm_radio_medium_t), PROT_READ | PROT_WRITE,
+                  MAP_SHARED, fd, 0);
+    real_close(fd);
+    if (medium == MAP_FAILED) {
+        err(EXIT_FAILURE, "shm_radio: unable to map %s", file);
+    }
+    if (__atomic_compare_exchange_n(&medium->magic, &magic, SHM_RADIO_MAGIC,
+                                    false, __ATOMIC_SEQ_CST,
+                                    __ATOMIC_SEQ_CST)) {
+        medium->version = SHM_RADIO_VERSION;
+        medium->ring_size = CONFIG_SHM_RADIO_RING_SIZE;
+    }
+    else if ((magic != SHM_RADIO_MAGIC) ||
+             (medium->version != SHM_RADIO_VERSION) ||
+             (medium->ring_size != CONFIG_SHM_RADIO_RING_SIZE)) {
+        errx(EXIT_FAILURE, "shm_radio: %s is no compatible medium", file);
+    }
+    return medium;
+}
+
+/* helper process waking up the device, whenever frames were written */
+static void _notify_child(shm_radio_medium_t *medium, int fd)
+{
+    uint32_t seen = __atomic_load_n(&medium->committed, __ATOMIC_SEQ_CST);
+    sigset_t sigmask;
+
+    sigfillset(&sigmask);
+    sigprocmask(SIG_BLOCK, &sigmask, NULL);
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+
+    while (1) {
+        uint32_t committed;
+        uint8_t notification = 0;
+
+        __atomic_fetch_add(&medium->waiters, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&medium->committed, __ATOMIC_SEQ_CST) == seen) {
+            syscall(SYS_futex, &medium->committed, FUTEX_WAIT, seen,
+                    NULL, NULL, 0);
+        }
+        __atomic_fetch_sub(&medium->waiters, 1, __ATOMIC_SEQ_CST);
+        committed = __atomic_load_n(&medium->committed, __ATOMIC_SEQ_CST);
+        if (committed != seen) {
+            seen = committed;
+            /* a full pipe already wakes up the device */
+            real_write(fd, &notification, sizeof(notification));
+        }
+    }
+}
+
+void shm_radio_setup(shm_radio_t *dev, const shm_radio_params_t *params)
+{
+    const char *file = (params->medium) ? params->medium
+                                        : CONFIG_SHM_RADIO_DEFAULT_MEDIUM;
+    int pipefd[2];
+    uint32_t id;
+
+    DEBUG("shm_radio_setup(%p, %p)\n", (void *)dev, (void *)params);
+    assert(params->loss <= 100);
+
+    memset(dev, 0, sizeof(shm_radio_t));
+    dev->netdev.netdev.driver = &shm_radio_driver;
+    dev->medium = _attach(file);
+    dev->latency = params->latency;
+    dev->loss = params->loss;
+    dev->timer.callback = _timer_cb;
+    dev->timer.arg = dev;
+    dev->next = __atomic_load_n(&dev->medium->head, __ATOMIC_SEQ_CST);
+    dev->id = id = __atomic_add_fetch(&dev->medium->last_id, 1,
+                                      __ATOMIC_SEQ_CST);
+
+    /* generate hardware address from the ID unique on the medium */
+    dev->netdev.long_addr[1] = 'S';     /* The "OUI" */
+    dev->netdev.long_addr[2] = 'H';
+    dev->netdev.long_addr[3] = 'M';
+    for (unsigned i = IEEE802154_LONG_ADDRESS_LEN; i > 4; i--) {
+        dev->netdev.long_addr[i - 1] = id & 0xff;
+        id >>= 8;
+    }
+    dev->netdev.short_addr[0] = dev->netdev.long_addr[6];
+    dev->netdev.short_addr[1] = dev->netdev.long_addr[7];
+
+    if (real_pipe(pipefd) < 0) {
+        err(EXIT_FAILURE, "shm_radio: pipe");
+    }
+    if (real_fcntl(pipefd[1], F_SETFL, O_NONBLOCK) < 0) {
+        err(EXIT_FAILURE, "shm_radio: fcntl");
+    }
+    if ((dev->notify_pid = real_fork()) < 0) {
+        err(EXIT_FAILURE, "shm_radio: fork");
+    }
+    if (dev->notify_pid == 0) {
+        real_close(pipefd[0]);
+        _notify_child(dev->medium, pipefd[1]);
+    }
+    real_close(pipefd[1]);
+    dev->notify_fd = pipefd[0];
+    native_async_read_setup();
+    native_async_read_add_handler(dev->notify_fd, dev, _notify_isr);
+}
+
+void shm_radio_cleanup(shm_radio_t *dev)
+{
+    assert(dev != NULL);
+    /* cleanup signal handling */
+    native_async_read_cleanup();
+    kill(dev->notify_pid, SIGKILL);
+    xtimer_remove(&dev->timer);
+    munmap(dev->medium, sizeof(shm_radio_medium_t));
+    dev->medium = NULL;
+}
+
+/** @} */
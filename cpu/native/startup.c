@@ -89,6 +89,11 @@ netdev_tap_params_t netdev_tap_params[NETDEV_TAP_MAX];
 
 socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #endif
+#ifdef MODULE_SHM_RADIO
+#include "shm_radio_params.h"
+
+shm_radio_params_t shm_radio_params[SHM_RADIO_MAX];
+#endif
 #ifdef MODULE_PERIPH_EEPROM
 #include "eeprom_native.h"
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
@@ -107,6 +112,9 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_SOCKET_ZEP
     "z:"
 #endif
+#ifdef MODULE_SHM_RADIO
+    "r:"
+#endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     "p:"
 #endif
@@ -133,6 +141,9 @@ static const struct option long_opts[] = {
 #ifdef MODULE_SOCKET_ZEP
     { "zep", required_argument, NULL, 'z' },
 #endif
+#ifdef MODULE_SHM_RADIO
+    { "shm-radio", required_argument, NULL, 'r' },
+#endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     { "spi", required_argument, NULL, 'p' },
 #endif
@@ -280,6 +291,11 @@ void usage_exit(int status)
         real_printf(" -z <laddr>:<lport>,<raddr>:<rport>\n");
     }
 #endif
+#if defined(MODULE_SHM_RADIO) && (SHM_RADIO_MAX > 0)
+    for (int i = 0; i < SHM_RADIO_MAX; i++) {
+        real_printf(" [-r <file>[,<loss>[,<latency>]]]\n");
+    }
+#endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     real_printf(" [-p <b>:<d>:<spidev>]\n");
 #endif
@@ -320,6 +336,15 @@ void usage_exit(int status)
 "        The ZEP interface connects to the remote address and may listen\n"
 "        on a local address.\n"
 "        Required to be provided SOCKET_ZEP_MAX times\n"
+#endif
+#if defined(MODULE_SHM_RADIO) && (SHM_RADIO_MAX > 0)
+"    -r <file>[,<loss>[,<latency>]], --shm-radio=<file>[,<loss>[,<latency>]]\n"
+"        attach a shared memory radio to the medium in <file> (optional,\n"
+"        " CONFIG_SHM_RADIO_DEFAULT_MEDIUM " is used if omitted). Received\n"
+"        frames are dropped with a probability of <loss> percent and\n"
+"        delayed by <latency> microseconds. All instances on the same\n"
+"        medium can reach each other.\n"
+"        Can be provided up to SHM_RADIO_MAX times\n"
 #endif
     );
 #ifdef MODULE_MTD_NATIVE
@@ -351,6 +376,37 @@ void usage_exit(int status)
     real_exit(status);
 }
 
+#ifdef MODULE_SHM_RADIO
+static void _shm_radio_params_setup(char *radio_str, unsigned radio)
+{
+    char *loss_str, *latency_str, *end;
+    unsigned long loss = 0, latency = 0;
+
+    if (radio >= SHM_RADIO_MAX) {
+        /* too many radios given */
+        usage_exit(EXIT_FAILURE);
+    }
+    radio_str = strdup(radio_str);
+    if ((loss_str = strchr(radio_str, ',')) != NULL) {
+        *(loss_str++) = '\0';
+        if ((latency_str = strchr(loss_str, ',')) != NULL) {
+            *(latency_str++) = '\0';
+            latency = strtoul(latency_str, &end, 10);
+            if (*end != '\0') {
+                usage_exit(EXIT_FAILURE);
+            }
+        }
+        loss = strtoul(loss_str, &end, 10);
+        if ((*end != '\0') || (loss > 100)) {
+            usage_exit(EXIT_FAILURE);
+        }
+    }
+    shm_radio_params[radio].medium = (radio_str[0] != '\0') ? radio_str : NULL;
+    shm_radio_params[radio].loss = loss;
+    shm_radio_params[radio].latency = latency;
+}
+#endif
+
 #ifdef MODULE_SOCKET_ZEP
 static void _parse_ep_str(char *ep_str, char **addr, char **port)
 {
@@ -449,6 +505,9 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
     int c, opt_idx = 0, uart = 0;
 #ifdef MODULE_SOCKET_ZEP
     unsigned zeps = 0;
+#endif
+#ifdef MODULE_SHM_RADIO
+    unsigned radios = 0;
 #endif
     bool dmn = false, force_stderr = false;
     _stdiotype_t stderrtype = _STDIOTYPE_STDIO;
@@ -528,6 +587,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 _zep_params_setup(optarg, zeps++);
                 break;
 #endif
+#ifdef MODULE_SHM_RADIO
+            case 'r':
+                _shm_radio_params_setup(optarg, radios++);
+                break;
+#endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
             case 'p': {
                     long bus = strtol(optarg, &optarg, 10);
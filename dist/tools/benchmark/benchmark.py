@@ -0,0 +1,178 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   agent <agent@local>
+
+"""
+Script to run the `tests/bench_*` applications on a board, collect the JSON
+results they print, and compare them against the results of a previous run.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import subprocess
+import sys
+
+RIOTBASE = os.path.abspath(os.path.join(os.path.dirname(__file__),
+                                        "..", "..", ".."))
+JSON_LINE = re.compile(r"(\{.*\})\s*$")
+# metrics for which a smaller value is better
+LOWER_IS_BETTER = ("min", "median", "p99", "max", "mean")
+
+
+def make(app, board, *targets):
+    """
+    Runs `make` for the given targets of an application and returns its
+    returncode and output
+    """
+    cmd = ["make", "--no-print-directory", "-C", app,
+           "BOARD={}".format(board)] + list(targets)
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT,
+                          universal_newlines=True)
+    return proc.returncode, proc.stdout
+
+
+def parse_results(output):
+    """
+    Returns all JSON objects printed on a line of their own in `output`
+    """
+    results = []
+    for line in output.splitlines():
+        match = JSON_LINE.search(line)
+        if match is None:
+            continue
+        try:
+            results.append(json.loads(match.group(1)))
+        except ValueError:
+            continue
+    return results
+
+
+def run_app(app, board, flash):
+    """
+    Builds, flashes, and runs the test of a benchmark application
+    """
+    res, _ = make(app, board, "test/available")
+    if res != 0:
+        return None
+    if flash:
+        res, output = make(app, board, "flash")
+        if res != 0:
+            return {"passed": False, "output": output, "results": []}
+    res, output = make(app, board, "test")
+    return {"passed": res == 0, "output": output,
+            "results": parse_results(output)}
+
+
+def lower_is_better(metric):
+    """
+    Returns True, if a smaller value of a metric is an improvement, False if a
+    larger value is, and None if the metric is a parameter of the benchmark
+    """
+    if metric in LOWER_IS_BETTER or metric.endswith("_us") or \
+       metric.startswith("time_per_"):
+        return True
+    if metric.endswith("_per_s") or metric.endswith("_per_sec") or \
+       metric.endswith("_per_kunit"):
+        return False
+    return None
+
+
+def result_key(result):
+    """
+    Identifies a result within an application by its parameters
+    """
+    return tuple(sorted((k, v) for k, v in result.items()
+                        if lower_is_better(k) is None))
+
+
+def compare(baseline, current, threshold):
+    """
+    Returns the metrics that changed for the worse by more than `threshold`
+    percent
+    """
+    regressions = []
+    for app, suite in current.items():
+        if app not in baseline:
+            continue
+        old_results = {result_key(r): r for r in baseline[app]["results"]}
+        for result in suite["results"]:
+            old = old_results.get(result_key(result))
+            if old is None:
+                continue
+            for metric, value in result.items():
+                lower = lower_is_better(metric)
+                if (lower is None) or (metric not in old) or \
+                   not isinstance(value, (int, float)) or (old[metric] == 0):
+                    continue
+                change = ((value - old[metric]) * 100) / old[metric]
+                if (lower and change > threshold) or \
+                   (not lower and -change > threshold):
+                    regressions.append((app, dict(result_key(result)),
+                                        metric, old[metric], value, change))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-b", "--board", default="native",
+                        help="Board to run the benchmarks on")
+    parser.add_argument("-a", "--apps", nargs="*",
+                        default=sorted(glob.glob(os.path.join(RIOTBASE,
+                                                              "tests",
+                                                              "bench_*"))),
+                        help="Benchmark applications to run")
+    parser.add_argument("-n", "--no-flash", action="store_true",
+                        help="Do not build and flash before running")
+    parser.add_argument("-o", "--output", default="benchmark.json",
+                        help="File to write the collected results to")
+    parser.add_argument("-c", "--compare",
+                        help="Results of a previous run to compare to")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="Change in percent reported as regression")
+    args = parser.parse_args()
+
+    current = {}
+    failed = []
+    for app in args.apps:
+        name = os.path.basename(os.path.normpath(app))
+        print("Running {}...".format(name), end=" ", flush=True)
+        suite = run_app(app, args.board, not args.no_flash)
+        if suite is None:
+            print("skipped")
+            continue
+        if not suite["passed"]:
+            print("failed")
+            failed.append((name, suite["output"]))
+        else:
+            print("{} results".format(len(suite["results"])))
+        del suite["output"]
+        current[name] = suite
+    with open(args.output, "w") as output:
+        json.dump({"board": args.board, "apps": current}, output, indent=2)
+
+    for name, output in failed:
+        print("\n{} failed:\n{}".format(name, output), file=sys.stderr)
+    regressions = []
+    if args.compare:
+        with open(args.compare) as baseline:
+            regressions = compare(json.load(baseline)["apps"], current,
+                                  args.threshold)
+        for app, params, metric, old, new, change in regressions:
+            print("{}: {} {}: {} -> {} ({:+.1f} %)".format(
+                app, params, metric, old, new, change
+            ))
+    return 1 if failed or regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,159 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   agent <agent@local>
+
+"""
+Script to convert the output of the `trace_event` shell command (provided by
+the `trace_event` module) into the Chrome trace event format, which can be
+opened with `chrome://tracing` or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+FORMAT_VERSION = 2
+# see trace_event_t in sys/include/trace_event.h
+EVENT_STRUCT = struct.Struct("<IBbxxII")
+BEGIN = re.compile(r"trace_event begin version=(\d+) events=(\d+) lost=(\d+)")
+THREAD = re.compile(r"thread (\d+) (\S+)")
+EVENT = re.compile(r"([0-9a-f]{%d})$" % (EVENT_STRUCT.size * 2))
+END = "trace_event end"
+
+PID_ISR = -1
+# TID used for interrupt context, KERNEL_PID_UNDEF is never a thread
+TID_ISR = 0
+
+(SCHED, MSG_SEND, MSG_RECV, ISR_ENTER, ISR_EXIT, PKTBUF_ALLOC, PKTBUF_FREE,
+ NETIF_SEND, NETIF_RECV, USER) = range(10)
+
+INSTANTS = {
+    MSG_SEND: ("msg_send", "msg", ("target", "type")),
+    MSG_RECV: ("msg_recv", "msg", ("sender", "type")),
+    PKTBUF_ALLOC: ("pktbuf_alloc", "pktbuf", ("size", "snip")),
+    PKTBUF_FREE: ("pktbuf_free", "pktbuf", ("size", "snip")),
+    NETIF_SEND: ("netif_send", "netif", ("netif", "pkt")),
+    NETIF_RECV: ("netif_recv", "netif", ("netif", "pkt")),
+    USER: ("user", "user", ("arg0", "arg1")),
+}
+
+
+class TraceParseError(Exception):
+    """
+    Error to convey that the dump could not be parsed
+    """
+    pass
+
+
+def parse_dump(lines):
+    """
+    Parses the first dump found in `lines` and returns the thread names and
+    the events as tuples of (time, type, pid, arg0, arg1)
+    """
+    threads = {}
+    events = []
+    offset = 0
+    lines = iter(lines)
+    for line in lines:
+        match = BEGIN.search(line)
+        if match:
+            if int(match.group(1)) != FORMAT_VERSION:
+                raise TraceParseError("Unsupported format version {}"
+                                      .format(match.group(1)))
+            break
+    else:
+        raise TraceParseError("No trace_event dump found")
+    for line in lines:
+        line = line.strip()
+        if line.endswith(END):
+            return threads, events
+        match = THREAD.search(line)
+        if match:
+            threads[int(match.group(1))] = match.group(2)
+            continue
+        match = EVENT.search(line)
+        if match:
+            event = EVENT_STRUCT.unpack(bytes.fromhex(match.group(1)))
+            time = event[0] + offset
+            # the timestamps are 32-bit microseconds, so they wrap around
+            # after ~71 min
+            if events and (time < (events[-1][0] - (1 << 31))):
+                offset += 1 << 32
+                time += 1 << 32
+            events.append((time,) + event[1:])
+    raise TraceParseError("Dump is incomplete")
+
+
+def _tid(pid):
+    return TID_ISR if pid == PID_ISR else pid
+
+
+def to_chrome_trace(threads, events):
+    """
+    Converts the thread names and events of a dump into a list of Chrome trace
+    events
+    """
+    trace = [{"name": "process_name", "ph": "M", "pid": 0,
+              "args": {"name": "RIOT"}},
+             {"name": "thread_name", "ph": "M", "pid": 0, "tid": TID_ISR,
+              "args": {"name": "ISR"}}]
+    for pid, name in threads.items():
+        trace.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": pid,
+                      "args": {"name": "{} ({})".format(name, pid)}})
+    running = None
+    # events may be out of order by the time it took to take their slot
+    for time, type_, pid, arg0, arg1 in sorted(events, key=lambda e: e[0]):
+        if type_ == SCHED:
+            if running is not None:
+                trace.append({"name": "running", "ph": "E", "pid": 0,
+                              "tid": running, "ts": time})
+            running = arg0 if arg0 > 0 else None
+            if running is not None:
+                trace.append({"name": "running", "cat": "sched", "ph": "B",
+                              "pid": 0, "tid": running, "ts": time})
+        elif type_ in (ISR_ENTER, ISR_EXIT):
+            trace.append({"name": "isr {}".format(arg0), "cat": "isr",
+                          "ph": "B" if type_ == ISR_ENTER else "E",
+                          "pid": 0, "tid": TID_ISR, "ts": time})
+        elif type_ in INSTANTS:
+            name, cat, args = INSTANTS[type_]
+            trace.append({"name": name, "cat": cat, "ph": "i", "s": "t",
+                          "pid": 0, "tid": _tid(pid), "ts": time,
+                          "args": dict(zip(args, (arg0, hex(arg1)
+                                                  if cat in ("pktbuf", "netif")
+                                                  else arg1)))})
+    if running is not None and events:
+        trace.append({"name": "running", "ph": "E", "pid": 0,
+                      "tid": running, "ts": max(e[0] for e in events)})
+    return trace
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="Output of the trace_event shell command "
+                             "(default: STDIN)")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="Chrome trace JSON file (default: STDOUT)")
+    args = parser.parse_args()
+    try:
+        threads, events = parse_dump(args.dump)
+    except TraceParseError as exc:
+        print(exc, file=sys.stderr)
+        return 1
+    json.dump({"traceEvents": to_chrome_trace(threads, events)}, args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
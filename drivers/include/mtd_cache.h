@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Page cache with read-ahead and write-back for MTD devices
+ *
+ * This MTD module stacks on top of another MTD device and keeps recently
+ * used pages of it in RAM. File systems such as littlefs or FatFs read the
+ * same pages again and again in small pieces, which then only cost a
+ * `memcpy()` instead of a bus transaction each.
+ *
+ * - **Reads** are served from the cache. On a miss the page is loaded
+ *   together with up to `read_ahead` following pages that are not cached
+ *   yet. The least recently used page is replaced.
+ * - **Writes** only modify the cached page and mark the written range as
+ *   dirty, so consecutive small writes to a page are coalesced into one
+ *   write to the backing device. Dirty pages are written back when they are
+ *   replaced, by @ref mtd_cache_flush() and before the device is powered
+ *   down.
+ * - **Erases** go straight to the backing device. Cached pages of the
+ *   erased sectors are dropped, including pending writes to them.
+ *
+ * The cache assumes that pages are erased before they are written, as is
+ * required for flash memory anyway: the cached data is what was written,
+ * while writing into programmed flash memory would only clear bits.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * The cache needs one @ref mtd_cache_line_t and one page of buffer per
+ * cached page:
+ *
+ * ```
+ * static mtd_cache_line_t lines[4];
+ * static uint8_t buf[4 * PAGE_SIZE];
+ * static mtd_cache_t cache = MTD_CACHE_INIT(&parent_dev, lines, buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of `cache.mtd` is taken from the backing device by
+ * @ref mtd_init(). Call @ref mtd_cache_flush() before the data must be on
+ * the backing device, e.g. when a file system syncs or before a reboot.
+ *
+ * @warning Do not access the backing device directly while it is cached.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_config     MTD page cache compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Default number of pages loaded ahead of a missed page
+ *
+ * Used by @ref MTD_CACHE_INIT. 0 disables read-ahead.
+ */
+#ifndef CONFIG_MTD_CACHE_READ_AHEAD
+#define CONFIG_MTD_CACHE_READ_AHEAD     (1U)
+#endif
+/** @} */
+
+/**
+ * @brief Shortcut macro for initializing the members of an
+ *        @ref mtd_cache_t struct
+ *
+ * @param[in] _parent   backing MTD device
+ * @param[in] _lines    array of @ref mtd_cache_line_t, one per cached page
+ * @param[in] _buf      array for the cached pages, one page size per line
+ */
+#define MTD_CACHE_INIT(_parent, _lines, _buf) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lines = _lines, \
+    .buf = _buf, \
+    .buf_size = sizeof(_buf), \
+    .lines_numof = ARRAY_SIZE(_lines), \
+    .read_ahead = CONFIG_MTD_CACHE_READ_AHEAD, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief MTD cache line, describes one cached page
+ */
+typedef struct {
+    uint32_t page;          /**< page number on the backing device */
+    uint32_t used;          /**< time of the last access, 0 if empty */
+    uint32_t dirty_start;   /**< offset of the first unwritten-back byte */
+    uint32_t dirty_end;     /**< end of the dirty range, 0 if clean */
+} mtd_cache_line_t;
+
+/**
+ * @brief MTD cache statistics
+ *
+ * Every page touched by a read or write counts as one access.
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses to cached pages */
+    uint32_t misses;        /**< accesses that loaded the page */
+    uint32_t read_ahead;    /**< pages loaded ahead of a miss */
+    uint32_t write_backs;   /**< dirty pages written to the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief MTD cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_cache_line_t *lines;    /**< cache lines */
+    uint8_t *buf;               /**< page buffers of the cache lines */
+    size_t buf_size;            /**< size of @ref mtd_cache_t::buf */
+    uint8_t lines_numof;        /**< number of cache lines */
+    uint8_t read_ahead;         /**< pages loaded ahead of a missed page */
+    mutex_t lock;               /**< guards the cache and the parent */
+    uint32_t now;               /**< access counter for replacement */
+    mtd_cache_stats_t stats;    /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Writes all dirty pages to the backing device
+ *
+ * The pages stay cached.
+ *
+ * @param[in] cache     the cache device
+ *
+ * @return 0 on success
+ * @return < 0 on error of the backing device, see @ref mtd_write_page()
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+/**
+ * @brief   Resets the statistics of a cache device
+ *
+ * @param[in] cache     the cache device
+ */
+void mtd_cache_stats_reset(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
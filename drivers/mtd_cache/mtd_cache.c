@@ -0,0 +1,418 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Page cache with read-ahead and write-back for MTD devices
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define MIN(a, b)   (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)   (((a) > (b)) ? (a) : (b))
+
+static uint32_t _pages(const mtd_cache_t *cache)
+{
+    return cache->mtd.sector_count * cache->mtd.pages_per_sector;
+}
+
+static uint8_t *_data(const mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return &cache->buf[(line - cache->lines) * cache->mtd.page_size];
+}
+
+static void _touch(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (cache->now == UINT32_MAX) {
+        /* renumber the lines by their rank before the counter wraps */
+        uint32_t used[cache->lines_numof];
+
+        for (unsigned i = 0; i < cache->lines_numof; i++) {
+            used[i] = cache->lines[i].used;
+        }
+        for (unsigned i = 0; i < cache->lines_numof; i++) {
+            if (used[i]) {
+                cache->lines[i].used = 1;
+                for (unsigned j = 0; j < cache->lines_numof; j++) {
+                    if (used[j] && (used[j] < used[i])) {
+                        cache->lines[i].used++;
+                    }
+                }
+            }
+        }
+        cache->now = cache->lines_numof;
+    }
+    line->used = ++cache->now;
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->used && (line->page == page)) {
+            return line;
+        }
+    }
+    return NULL;
+}
+
+/* an empty line or else the least recently used one */
+static mtd_cache_line_t *_victim(mtd_cache_t *cache)
+{
+    mtd_cache_line_t *victim = &cache->lines[0];
+
+    for (unsigned i = 0; (i < cache->lines_numof) && victim->used; i++) {
+        if (cache->lines[i].used < victim->used) {
+            victim = &cache->lines[i];
+        }
+    }
+    return victim;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (line->dirty_end) {
+        int res = mtd_write_page(cache->parent,
+                                 _data(cache, line) + line->dirty_start,
+                                 line->page, line->dirty_start,
+                                 line->dirty_end - line->dirty_start);
+
+        DEBUG("mtd_cache: write back page %lu [%lu, %lu): %d\n",
+              (unsigned long)line->page, (unsigned long)line->dirty_start,
+              (unsigned long)line->dirty_end, res);
+        if (res < 0) {
+            return res;
+        }
+        line->dirty_end = 0;
+        cache->stats.write_backs++;
+    }
+    return 0;
+}
+
+/* loads numof pages into consecutive lines with a single read */
+static int _load(mtd_cache_t *cache, mtd_cache_line_t *first, unsigned numof)
+{
+    int res = mtd_read_page(cache->parent, _data(cache, first), first->page, 0,
+                            numof * cache->mtd.page_size);
+
+    DEBUG("mtd_cache: load pages [%lu, %lu): %d\n", (unsigned long)first->page,
+          (unsigned long)(first->page + numof), res);
+    if (res < 0) {
+        for (unsigned i = 0; i < numof; i++) {
+            first[i].used = 0;
+        }
+    }
+    return res;
+}
+
+/* loads page into the cache, and on sequential access the pages after it */
+static int _miss(mtd_cache_t *cache, uint32_t page, mtd_cache_line_t **line)
+{
+    unsigned ahead = 0;
+    mtd_cache_line_t *first;
+    unsigned numof = 1;
+    int res;
+
+    if ((page > 0) && _find(cache, page - 1)) {
+        /* the missed page must not be replaced by the pages read ahead */
+        ahead = MIN(cache->read_ahead, cache->lines_numof - 1U);
+    }
+
+    *line = first = _victim(cache);
+    res = _write_back(cache, first);
+    if (res < 0) {
+        return res;
+    }
+    first->page = page;
+    _touch(cache, first);
+    cache->stats.misses++;
+
+    for (unsigned i = 1; i <= ahead; i++) {
+        mtd_cache_line_t *victim;
+
+        if (((page + i) >= _pages(cache)) || _find(cache, page + i)) {
+            break;
+        }
+        victim = _victim(cache);
+        /* read-ahead is not worth a write */
+        if (victim->dirty_end) {
+            break;
+        }
+        if (victim != &first[numof]) {
+            /* load what is consecutive so far, the missed page is in the
+             * first batch */
+            res = _load(cache, first, numof);
+            if (res < 0) {
+                return (first == *line) ? res : 0;
+            }
+            first = victim;
+            numof = 0;
+        }
+        victim->page = page + i;
+        _touch(cache, victim);
+        numof++;
+        cache->stats.read_ahead++;
+    }
+
+    res = _load(cache, first, numof);
+    if (res < 0) {
+        return (first == *line) ? res : 0;
+    }
+    return 0;
+}
+
+static int _read_pages(mtd_cache_t *cache, uint8_t *dest, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    while (count) {
+        mtd_cache_line_t *line = _find(cache, page);
+        uint32_t len = MIN(count, cache->mtd.page_size - offset);
+
+        if (line) {
+            _touch(cache, line);
+            cache->stats.hits++;
+        }
+        else {
+            int res = _miss(cache, page, &line);
+
+            if (res < 0) {
+                return res;
+            }
+        }
+        memcpy(dest, _data(cache, line) + offset, len);
+        dest += len;
+        count -= len;
+        offset = 0;
+        page++;
+    }
+    return 0;
+}
+
+static int _write_pages(mtd_cache_t *cache, const uint8_t *src, uint32_t page,
+                        uint32_t offset, uint32_t count)
+{
+    while (count) {
+        mtd_cache_line_t *line = _find(cache, page);
+        uint32_t len = MIN(count, cache->mtd.page_size - offset);
+
+        if (line) {
+            _touch(cache, line);
+            cache->stats.hits++;
+        }
+        else if (len == cache->mtd.page_size) {
+            /* the whole page is overwritten, no need to load it */
+            int res;
+
+            line = _victim(cache);
+            res = _write_back(cache, line);
+            if (res < 0) {
+                return res;
+            }
+            line->page = page;
+            _touch(cache, line);
+            cache->stats.misses++;
+        }
+        else {
+            int res = _miss(cache, page, &line);
+
+            if (res < 0) {
+                return res;
+            }
+        }
+        memcpy(_data(cache, line) + offset, src, len);
+        if (line->dirty_end == 0) {
+            line->dirty_start = offset;
+            line->dirty_end = offset + len;
+        }
+        else {
+            line->dirty_start = MIN(line->dirty_start, offset);
+            line->dirty_end = MAX(line->dirty_end, offset + len);
+        }
+        src += len;
+        count -= len;
+        offset = 0;
+        page++;
+    }
+    return 0;
+}
+
+static int _flush(mtd_cache_t *cache)
+{
+    /* in ascending page order, flash memory is often programmed faster
+     * sequentially */
+    while (1) {
+        mtd_cache_line_t *next = NULL;
+        int res;
+
+        for (unsigned i = 0; i < cache->lines_numof; i++) {
+            mtd_cache_line_t *line = &cache->lines[i];
+
+            if (line->used && line->dirty_end &&
+                (!next || (line->page < next->page))) {
+                next = line;
+            }
+        }
+        if (!next) {
+            return 0;
+        }
+        res = _write_back(cache, next);
+        if (res < 0) {
+            return res;
+        }
+    }
+}
+
+static bool _in_range(mtd_cache_t *cache, uint32_t page, uint32_t offset,
+                      uint32_t count)
+{
+    uint64_t end = ((uint64_t)page * cache->mtd.page_size) + offset + count;
+
+    return end <= ((uint64_t)_pages(cache) * cache->mtd.page_size);
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res;
+
+    mutex_lock(&cache->lock);
+    res = mtd_init(cache->parent);
+    if (res == 0) {
+        mtd->sector_count = cache->parent->sector_count;
+        mtd->pages_per_sector = cache->parent->pages_per_sector;
+        mtd->page_size = cache->parent->page_size;
+
+        /* Configuration sanity checks */
+        assert(cache->lines_numof > 0);
+        assert(cache->buf_size >= (cache->lines_numof * mtd->page_size));
+
+        memset(cache->lines, 0, cache->lines_numof * sizeof(*cache->lines));
+        cache->now = 0;
+        memset(&cache->stats, 0, sizeof(cache->stats));
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    page += offset / mtd->page_size;
+    offset %= mtd->page_size;
+    if (!_in_range(cache, page, offset, count)) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    int res = _read_pages(cache, dest, page, offset, count);
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    page += offset / mtd->page_size;
+    offset %= mtd->page_size;
+    if (!_in_range(cache, page, offset, count)) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    int res = _write_pages(cache, src, page, offset, count);
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t first = sector * mtd->pages_per_sector;
+    uint32_t last = first + (count * mtd->pages_per_sector);
+
+    if ((sector + count) > mtd->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    /* pending writes to erased pages are void */
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if ((line->page >= first) && (line->page < last)) {
+            line->used = 0;
+            line->dirty_end = 0;
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    if (power == MTD_POWER_DOWN) {
+        res = _flush(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+void mtd_cache_stats_reset(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+};
@@ -36,6 +36,9 @@ PSEUDOMODULES += gnrc_ipv6_nib_6lbr
 PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
 PSEUDOMODULES += gnrc_ipv6_nib_dns
+PSEUDOMODULES += gnrc_ipv6_nib_lpm
+PSEUDOMODULES += gnrc_ipv6_nib_nc_hash
+PSEUDOMODULES += gnrc_ipv6_nib_rc
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_netdev_default
 PSEUDOMODULES += gnrc_neterr
@@ -51,6 +54,7 @@ PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_cmd_%
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netreg_hash
 PSEUDOMODULES += gnrc_nettype_%
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
@@ -62,9 +66,15 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_tcp_cc
+PSEUDOMODULES += gnrc_tcp_sack
 PSEUDOMODULES += gnrc_txtsnd
+PSEUDOMODULES += hashes_sha2xx_unrolled
+PSEUDOMODULES += hashes_sha2xx_x86
 PSEUDOMODULES += heap_cmd
 PSEUDOMODULES += i2c_scan
+PSEUDOMODULES += inet_csum_word
+PSEUDOMODULES += inet_csum_x86
 PSEUDOMODULES += ieee802154_radio_hal
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -87,6 +97,7 @@ PSEUDOMODULES += netdev_ieee802154
 PSEUDOMODULES += netdev_eth
 PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_register
+PSEUDOMODULES += netdev_tap_batch
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_ipv6
@@ -280,6 +291,12 @@ PSEUDOMODULES += ds18_optimized
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# constant-time AES without lookup tables (larger cipher context)
+PSEUDOMODULES += crypto_aes_ct
+# AES-NI on native, falls back to crypto_aes_ct on CPUs without it
+PSEUDOMODULES += crypto_aes_x86
+# ChaCha20 key stream with SSE2/AVX2 on native
+PSEUDOMODULES += crypto_chacha20poly1305_x86
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
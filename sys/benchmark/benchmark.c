@@ -19,9 +19,65 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "benchmark.h"
 
+uint32_t benchmark_samples[CONFIG_BENCHMARK_SAMPLES_MAX];
+
+void benchmark_cycles_init(void)
+{
+#ifdef BENCHMARK_CYCLES_DWT
+    /* cores may be built without cycle counter */
+    assert(!(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk));
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef CPU_CORE_CORTEX_M7
+    /* unlock the DWT registers */
+    DWT->LAR = 0xc5acce55;
+#endif
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+void benchmark_stats(uint32_t *samples, unsigned numof,
+                     benchmark_stats_t *stats)
+{
+    uint64_t sum = 0;
+
+    assert(numof > 0);
+    qsort(samples, numof, sizeof(samples[0]), _cmp);
+    for (unsigned i = 0; i < numof; i++) {
+        sum += samples[i];
+    }
+    stats->min = samples[0];
+    stats->median = (numof & 1) ? samples[numof / 2]
+                  : (uint32_t)(((uint64_t)samples[(numof / 2) - 1] +
+                                samples[numof / 2]) / 2);
+    /* nearest-rank method: smallest sample not below 99 % of the samples */
+    stats->p99 = samples[((99UL * numof + 99) / 100) - 1];
+    stats->max = samples[numof - 1];
+    stats->mean = (uint32_t)(sum / numof);
+}
+
+void benchmark_print_stats(const char *name, unsigned long runs,
+                           unsigned numof, const benchmark_stats_t *stats)
+{
+    printf("{ \"name\" : \"%s\", \"unit\" : \"" BENCHMARK_CYCLES_UNIT "\", "
+           "\"runs\" : %lu, \"samples\" : %u, \"min\" : %" PRIu32 ", "
+           "\"median\" : %" PRIu32 ", \"p99\" : %" PRIu32 ", "
+           "\"max\" : %" PRIu32 ", \"mean\" : %" PRIu32 " }\n",
+           name, runs, numof, stats->min, stats->median, stats->p99,
+           stats->max, stats->mean);
+}
+
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
     uint32_t full = (time / runs);
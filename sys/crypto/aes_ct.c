@@ -0,0 +1,550 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Constant-time implementation of the AES cipher-algorithm
+ *
+ * The state of two blocks is bitsliced into eight 32-bit words, so every
+ * step of a round is computed with the same sequence of logical operations
+ * for any key and data. The S-box is the circuit by Boyar and Peralta
+ * ("A depth-16 circuit for the AES S-box", 2011). The representation
+ * follows the `aes_ct` implementation of BearSSL by Thomas Pornin.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+
+#include <assert.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+
+#define AES_CT_ROUNDS       (10U)
+/* number of words of the compressed key schedule, 4 per round key */
+#define AES_CT_SKEY_WORDS   (4U * (AES_CT_ROUNDS + 1))
+
+/* the compressed key schedule is kept in the context */
+static_assert(CIPHER_MAX_CONTEXT_SIZE >= (AES_CT_SKEY_WORDS * 4),
+              "cipher context too small for the AES key schedule");
+
+static inline uint32_t _dec32le(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+           ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static inline void _enc32le(uint8_t *dst, uint32_t x)
+{
+    dst[0] = (uint8_t)x;
+    dst[1] = (uint8_t)(x >> 8);
+    dst[2] = (uint8_t)(x >> 16);
+    dst[3] = (uint8_t)(x >> 24);
+}
+
+/* bitsliced S-box on the eight words of the state */
+static void _sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/* the inverse of the affine transformation of the S-box, which is an
+ * involution combined with the S-box itself */
+static void _inv_affine(uint32_t *q)
+{
+    uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+/* bitsliced inverse S-box: the inverse in GF(2^8) is its own inverse, so
+ * only the affine transformation around it has to be inverted */
+static void _inv_sbox(uint32_t *q)
+{
+    _inv_affine(q);
+    _sbox(q);
+    _inv_affine(q);
+}
+
+#define SWAPN(cl, ch, s, x, y)                                  \
+    do {                                                        \
+        uint32_t a = (x), b = (y);                              \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+
+#define SWAP2(x, y)     SWAPN(0x55555555, 0xaaaaaaaa, 1, x, y)
+#define SWAP4(x, y)     SWAPN(0x33333333, 0xcccccccc, 2, x, y)
+#define SWAP8(x, y)     SWAPN(0x0f0f0f0f, 0xf0f0f0f0, 4, x, y)
+
+/* converts between the bitsliced and the regular representation (both
+ * directions are the same operation) */
+static void _ortho(uint32_t *q)
+{
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+}
+
+static uint32_t _sub_word(uint32_t x)
+{
+    uint32_t q[8] = { x };
+
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    return q[0];
+}
+
+static void _keysched(uint32_t *comp_skey, const uint8_t *key)
+{
+    static const uint8_t rcon[] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+    };
+    /* each word twice, so _ortho() works on both copies like on two
+     * blocks */
+    uint32_t skey[AES_CT_SKEY_WORDS * 2];
+    const unsigned nk = AES_KEY_SIZE / 4;
+    uint32_t tmp = 0;
+
+    for (unsigned i = 0; i < nk; i++) {
+        tmp = _dec32le(&key[i * 4]);
+        skey[(i * 2)] = tmp;
+        skey[(i * 2) + 1] = tmp;
+    }
+    for (unsigned i = nk, j = 0, k = 0; i < AES_CT_SKEY_WORDS; i++) {
+        if (j == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = _sub_word(tmp) ^ rcon[k];
+        }
+        tmp ^= skey[(i - nk) * 2];
+        skey[(i * 2)] = tmp;
+        skey[(i * 2) + 1] = tmp;
+        if (++j == nk) {
+            j = 0;
+            k++;
+        }
+    }
+    for (unsigned i = 0; i < AES_CT_SKEY_WORDS; i += 4) {
+        _ortho(&skey[i * 2]);
+    }
+    /* both copies are the same, so keep only every other bit of each */
+    for (unsigned i = 0; i < AES_CT_SKEY_WORDS; i++) {
+        comp_skey[i] = (skey[(i * 2)] & 0x55555555) |
+                       (skey[(i * 2) + 1] & 0xaaaaaaaa);
+    }
+}
+
+static void _skey_expand(uint32_t *skey, const cipher_context_t *context)
+{
+    for (unsigned i = 0; i < AES_CT_SKEY_WORDS; i++) {
+        uint32_t x, y;
+
+        /* the context is not necessarily aligned */
+        memcpy(&x, &context->context[i * 4], sizeof(x));
+        y = x;
+        x &= 0x55555555;
+        skey[(i * 2)] = x | (x << 1);
+        y &= 0xaaaaaaaa;
+        skey[(i * 2) + 1] = y | (y >> 1);
+    }
+}
+
+static inline void _add_round_key(uint32_t *q, const uint32_t *sk)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+static inline void _shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000ff) |
+               ((x & 0x0000fc00) >> 2) | ((x & 0x00000300) << 6) |
+               ((x & 0x00f00000) >> 4) | ((x & 0x000f0000) << 4) |
+               ((x & 0xc0000000) >> 6) | ((x & 0x3f000000) << 2);
+    }
+}
+
+static inline void _inv_shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000ff) |
+               ((x & 0x00003f00) << 2) | ((x & 0x0000c000) >> 6) |
+               ((x & 0x000f0000) << 4) | ((x & 0x00f00000) >> 4) |
+               ((x & 0x03000000) << 6) | ((x & 0xfc000000) >> 2);
+    }
+}
+
+static inline uint32_t _rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static inline void _mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24), r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24), r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24), r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24), r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ _rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ _rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ _rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ _rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ _rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ _rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ _rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ _rotr16(q7 ^ r7);
+}
+
+static inline void _inv_mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24), r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24), r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24), r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24), r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ _rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^
+           _rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^
+           _rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^
+           _rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ _rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+static void _encrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, skey);
+    for (unsigned u = 1; u < AES_CT_ROUNDS; u++) {
+        _sbox(q);
+        _shift_rows(q);
+        _mix_columns(q);
+        _add_round_key(q, &skey[u * 8]);
+    }
+    _sbox(q);
+    _shift_rows(q);
+    _add_round_key(q, &skey[AES_CT_ROUNDS * 8]);
+}
+
+static void _decrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, &skey[AES_CT_ROUNDS * 8]);
+    for (unsigned u = AES_CT_ROUNDS - 1; u > 0; u--) {
+        _inv_shift_rows(q);
+        _inv_sbox(q);
+        _add_round_key(q, &skey[u * 8]);
+        _inv_mix_columns(q);
+    }
+    _inv_shift_rows(q);
+    _inv_sbox(q);
+    _add_round_key(q, skey);
+}
+
+/* loads two blocks into the bitsliced state */
+static void _load(uint32_t *q, const uint8_t *in0, const uint8_t *in1)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        q[(i * 2)] = _dec32le(&in0[i * 4]);
+        q[(i * 2) + 1] = _dec32le(&in1[i * 4]);
+    }
+    _ortho(q);
+}
+
+/* stores the two blocks of the bitsliced state */
+static void _store(uint32_t *q, uint8_t *out0, uint8_t *out1)
+{
+    _ortho(q);
+    for (unsigned i = 0; i < 4; i++) {
+        _enc32le(&out0[i * 4], q[(i * 2)]);
+        _enc32le(&out1[i * 4], q[(i * 2) + 1]);
+    }
+}
+
+int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
+{
+    uint32_t comp_skey[AES_CT_SKEY_WORDS];
+
+    /* This implementation only supports a single key size (defined in AES_KEY_SIZE) */
+    if (keySize != AES_KEY_SIZE) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
+    }
+
+#if IS_USED(MODULE_CRYPTO_AES_X86)
+    if (aes_x86_supported()) {
+        aes_x86_init(context, key);
+        return CIPHER_INIT_SUCCESS;
+    }
+#endif
+    _keysched(comp_skey, key);
+    memcpy(context->context, comp_skey, sizeof(comp_skey));
+
+    return CIPHER_INIT_SUCCESS;
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    uint32_t skey[AES_CT_SKEY_WORDS * 2];
+    uint32_t q[8];
+
+#if IS_USED(MODULE_CRYPTO_AES_X86)
+    if (aes_x86_supported()) {
+        aes_x86_encrypt_blocks(context, input, output, numof);
+        return 1;
+    }
+#endif
+    _skey_expand(skey, context);
+    for (; numof >= 2; numof -= 2) {
+        _load(q, input, input + AES_BLOCK_SIZE);
+        _encrypt(skey, q);
+        _store(q, output, output + AES_BLOCK_SIZE);
+        input += 2 * AES_BLOCK_SIZE;
+        output += 2 * AES_BLOCK_SIZE;
+    }
+    if (numof) {
+        /* a single block is processed along with a dummy block */
+        uint8_t dummy[AES_BLOCK_SIZE] = { 0 };
+
+        _load(q, input, dummy);
+        _encrypt(skey, q);
+        _store(q, output, dummy);
+    }
+    return 1;
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    uint32_t skey[AES_CT_SKEY_WORDS * 2];
+    uint32_t q[8];
+    uint8_t dummy[AES_BLOCK_SIZE] = { 0 };
+
+#if IS_USED(MODULE_CRYPTO_AES_X86)
+    if (aes_x86_supported()) {
+        aes_x86_decrypt(context, cipher_block, plain_block);
+        return 1;
+    }
+#endif
+    _skey_expand(skey, context);
+    _load(q, cipher_block, dummy);
+    _decrypt(skey, q);
+    _store(q, plain_block, dummy);
+    return 1;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif
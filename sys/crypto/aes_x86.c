@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       AES using the x86 AES instructions (AES-NI)
+ *
+ * The functions are compiled for the AES instructions only, so the rest of
+ * RIOT keeps running on any x86 CPU. Whether the CPU provides them is checked
+ * once at runtime, @ref aes_ct.c is used otherwise.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_X86) && \
+    (defined(__i386__) || defined(__x86_64__))
+
+#include <assert.h>
+#include <cpuid.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <wmmintrin.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+
+#define AES_X86_ROUNDS      (10U)
+/* blocks in flight, so the latency of aesenc is hidden */
+#define AES_X86_INTERLEAVE  (4U)
+
+#define CPU_AES             (1U << 0)
+#define CPU_CHECKED         (1U << 1)
+
+/* the expanded encryption key is kept in the context, the decryption key is
+ * derived from it when needed */
+static_assert(CIPHER_MAX_CONTEXT_SIZE >=
+              ((AES_X86_ROUNDS + 1) * AES_BLOCK_SIZE),
+              "cipher context too small for the AES key schedule");
+
+static unsigned _cpu;
+
+bool aes_x86_supported(void)
+{
+    unsigned eax, ebx, ecx, edx;
+
+    /* the result is always the same, so concurrent checks do no harm */
+    if (!_cpu) {
+        _cpu = CPU_CHECKED;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES) &&
+            (ecx & bit_SSE2)) {
+            _cpu |= CPU_AES;
+        }
+    }
+    return _cpu & CPU_AES;
+}
+
+__attribute__((target("aes,sse2")))
+static inline __m128i _expand(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/* aeskeygenassist takes the round constant as immediate */
+#define EXPAND(rk, i, rcon) \
+    rk[i] = _expand(rk[(i) - 1], _mm_aeskeygenassist_si128(rk[(i) - 1], rcon))
+
+__attribute__((target("aes,sse2")))
+void aes_x86_init(cipher_context_t *context, const uint8_t *key)
+{
+    __m128i rk[AES_X86_ROUNDS + 1];
+
+    rk[0] = _mm_loadu_si128((const __m128i *)key);
+    EXPAND(rk, 1, 0x01);
+    EXPAND(rk, 2, 0x02);
+    EXPAND(rk, 3, 0x04);
+    EXPAND(rk, 4, 0x08);
+    EXPAND(rk, 5, 0x10);
+    EXPAND(rk, 6, 0x20);
+    EXPAND(rk, 7, 0x40);
+    EXPAND(rk, 8, 0x80);
+    EXPAND(rk, 9, 0x1b);
+    EXPAND(rk, 10, 0x36);
+    memcpy(context->context, rk, sizeof(rk));
+}
+
+__attribute__((target("aes,sse2")))
+void aes_x86_encrypt_blocks(const cipher_context_t *context,
+                            const uint8_t *input, uint8_t *output,
+                            size_t numof)
+{
+    const __m128i *ctx = (const __m128i *)context->context;
+    __m128i rk[AES_X86_ROUNDS + 1];
+
+    for (unsigned i = 0; i <= AES_X86_ROUNDS; i++) {
+        rk[i] = _mm_loadu_si128(&ctx[i]);
+    }
+    for (; numof >= AES_X86_INTERLEAVE; numof -= AES_X86_INTERLEAVE) {
+        __m128i b[AES_X86_INTERLEAVE];
+
+        for (unsigned j = 0; j < AES_X86_INTERLEAVE; j++) {
+            b[j] = _mm_xor_si128(_mm_loadu_si128(
+                                     (const __m128i *)&input[j * AES_BLOCK_SIZE]),
+                                 rk[0]);
+        }
+        for (unsigned i = 1; i < AES_X86_ROUNDS; i++) {
+            for (unsigned j = 0; j < AES_X86_INTERLEAVE; j++) {
+                b[j] = _mm_aesenc_si128(b[j], rk[i]);
+            }
+        }
+        for (unsigned j = 0; j < AES_X86_INTERLEAVE; j++) {
+            _mm_storeu_si128((__m128i *)&output[j * AES_BLOCK_SIZE],
+                             _mm_aesenclast_si128(b[j], rk[AES_X86_ROUNDS]));
+        }
+        input += AES_X86_INTERLEAVE * AES_BLOCK_SIZE;
+        output += AES_X86_INTERLEAVE * AES_BLOCK_SIZE;
+    }
+    for (; numof; numof--) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)input),
+                                  rk[0]);
+
+        for (unsigned i = 1; i < AES_X86_ROUNDS; i++) {
+            b = _mm_aesenc_si128(b, rk[i]);
+        }
+        _mm_storeu_si128((__m128i *)output,
+                         _mm_aesenclast_si128(b, rk[AES_X86_ROUNDS]));
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+}
+
+__attribute__((target("aes,sse2")))
+void aes_x86_decrypt(const cipher_context_t *context,
+                     const uint8_t *cipher_block, uint8_t *plain_block)
+{
+    const __m128i *ctx = (const __m128i *)context->context;
+    __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)cipher_block),
+                              _mm_loadu_si128(&ctx[AES_X86_ROUNDS]));
+
+    /* equivalent inverse cipher, the round keys go through InvMixColumns */
+    for (unsigned i = AES_X86_ROUNDS - 1; i > 0; i--) {
+        b = _mm_aesdec_si128(b, _mm_aesimc_si128(_mm_loadu_si128(&ctx[i])));
+    }
+    b = _mm_aesdeclast_si128(b, _mm_loadu_si128(&ctx[0]));
+    _mm_storeu_si128((__m128i *)plain_block, b);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif
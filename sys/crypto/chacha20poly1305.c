@@ -43,95 +43,170 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+#define ROTL(v, n)      (((v) << (n)) | ((v) >> (32 - (n))))
+#define QR(x, a, b, c, d)                                               \
+    do {                                                                \
+        x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL(x[d], 16);              \
+        x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL(x[b], 12);              \
+        x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL(x[d], 8);               \
+        x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL(x[b], 7);               \
+    } while (0)
+
+/* State of the en-/decryption of a message */
+typedef struct {
+    uint32_t state[16];     /* initial state of the next key stream block */
+    uint8_t stream[CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS *
+                   CHACHA20POLY1305_BLOCK_BYTES]; /* key stream */
+    size_t pos;             /* bytes of the key stream used */
+    size_t avail;           /* bytes of the key stream generated */
+    size_t remaining;       /* bytes of the message left */
+} _xcrypt_ctx_t;
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+static void _init_state(uint32_t *state, const uint8_t *key,
+                        const uint8_t *nonce, uint32_t blk)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        state[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        state[i+4] = unaligned_get_u32(key + 4*i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    state[12] = blk;
+    state[13] = unaligned_get_u32(nonce);
+    state[14] = unaligned_get_u32(nonce+4);
+    state[15] = unaligned_get_u32(nonce+8);
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+/* Computes one key stream block, out may be the same as init */
+static void _block(uint8_t *out, const uint32_t *init)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
+    uint32_t x[16];
+
+    memcpy(x, init, sizeof(x));
+    /* the quarter rounds are unrolled, so no index is computed at runtime */
+    for (unsigned i = 0; i < 10; i++) {
+        QR(x, 0, 4, 8, 12);
+        QR(x, 1, 5, 9, 13);
+        QR(x, 2, 6, 10, 14);
+        QR(x, 3, 7, 11, 15);
+        QR(x, 0, 5, 10, 15);
+        QR(x, 1, 6, 11, 12);
+        QR(x, 2, 7, 8, 13);
+        QR(x, 3, 4, 9, 14);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += init[i];
     }
-    /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    memcpy(out, x, sizeof(x));
+    crypto_secure_wipe(x, sizeof(x));
 }
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+/* Computes numof key stream blocks and advances the block counter */
+static void _keystream(uint8_t *out, uint32_t *state, size_t numof)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i+1);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    while (numof) {
+        size_t done = 0;
+
+#if IS_USED(MODULE_CRYPTO_CHACHA20POLY1305_X86)
+        done = chacha20poly1305_x86_keystream(out, state, numof);
+#endif
+        if (done == 0) {
+            _block(out, state);
+            done = 1;
         }
+        state[12] += done;
+        out += done * CHACHA20POLY1305_BLOCK_BYTES;
+        numof -= done;
     }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks+1);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+}
+
+static void _xcrypt_init(_xcrypt_ctx_t *ctx, const uint8_t *key,
+                         const uint8_t *nonce, size_t len)
+{
+    /* block 0 is the one time key of poly1305 */
+    _init_state(ctx->state, key, nonce, 1);
+    ctx->pos = 0;
+    ctx->avail = 0;
+    ctx->remaining = len;
+}
+
+static void _xcrypt(_xcrypt_ctx_t *ctx, const uint8_t *in, uint8_t *out,
+                    size_t len)
+{
+    while (len) {
+        size_t chunk;
+
+        if (ctx->pos == ctx->avail) {
+            /* only as many blocks as the rest of the message needs */
+            size_t numof = (ctx->remaining + CHACHA20POLY1305_BLOCK_BYTES - 1) /
+                           CHACHA20POLY1305_BLOCK_BYTES;
+
+            if (numof > CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS) {
+                numof = CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS;
+            }
+            _keystream(ctx->stream, ctx->state, numof);
+            ctx->avail = numof * CHACHA20POLY1305_BLOCK_BYTES;
+            ctx->pos = 0;
+        }
+        chunk = ctx->avail - ctx->pos;
+        if (chunk > len) {
+            chunk = len;
+        }
+        for (size_t i = 0; i < chunk; i++) {
+            out[i] = in[i] ^ ctx->stream[ctx->pos + i];
         }
+        ctx->pos += chunk;
+        ctx->remaining -= chunk;
+        in += chunk;
+        out += chunk;
+        len -= chunk;
     }
 }
 
-static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
+/* Wipes the key stream of a message of len bytes */
+static void _xcrypt_wipe(_xcrypt_ctx_t *ctx, size_t len)
 {
-    poly1305_update(pctx, data, len);
-    const size_t padlen = (16 - len) & 0xF;
+    /* the first batch of key stream is the largest, and it consists of
+     * whole blocks */
+    len = (len + CHACHA20POLY1305_BLOCK_BYTES - 1) &
+          ~(CHACHA20POLY1305_BLOCK_BYTES - 1);
+    if (len > sizeof(ctx->stream)) {
+        len = sizeof(ctx->stream);
+    }
+    crypto_secure_wipe(ctx->state, sizeof(ctx->state));
+    crypto_secure_wipe(ctx->stream, len);
+}
+
+/* Adds all entries of data, padded to the poly1305 block size, and returns
+ * the length of data */
+static uint64_t _poly1305_padded(poly1305_ctx_t *pctx, const iolist_t *data)
+{
+    uint64_t len = 0;
+
+    for (; data; data = data->iol_next) {
+        poly1305_update(pctx, data->iol_base, data->iol_len);
+        len += data->iol_len;
+    }
+    const size_t padlen = (16 - pctx->c_idx) & 0xF;
     poly1305_update(pctx, padding, padlen);
+    return len;
 }
 
 /* Generate a poly1305 tag */
 static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *nonce,
-                             const uint8_t *cipher, size_t cipherlen,
-                             const uint8_t *aad, size_t aadlen)
+                             const iolist_t *cipher, const iolist_t *aad)
 {
     chacha20poly1305_ctx_t ctx;
+    uint64_t lengths[2];
     /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
+    _init_state(ctx.state, key, nonce, 0);
+    _block((uint8_t*)ctx.state, ctx.state);
     poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
     /* Add aad */
-    _poly1305_padded(&ctx.poly, aad, aadlen);
+    lengths[0] = _poly1305_padded(&ctx.poly, aad);
     /* Add ciphertext */
-    _poly1305_padded(&ctx.poly, cipher, cipherlen);
+    lengths[1] = _poly1305_padded(&ctx.poly, cipher);
     /* Add aad length */
-    const uint64_t lengths[2] = {aadlen, cipherlen};
     poly1305_update(&ctx.poly, (uint8_t*)lengths, sizeof(lengths));
     poly1305_finish(&ctx.poly, mac);
     crypto_secure_wipe(&ctx, sizeof(ctx));
@@ -141,13 +216,15 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    iolist_t aad_list = { .iol_base = (uint8_t *)aad, .iol_len = aadlen };
+    iolist_t cipher_list = { .iol_base = cipher, .iol_len = msglen };
+    _xcrypt_ctx_t ctx;
+
+    _xcrypt_init(&ctx, key, nonce, msglen);
+    _xcrypt(&ctx, msg, cipher, msglen);
+    _xcrypt_wipe(&ctx, msglen);
     /* Generate tag */
-    _poly1305_gentag(&cipher[msglen], key, nonce,
-                    cipher, msglen, aad, aadlen);
-    /* Wipe structures */
+    _poly1305_gentag(&cipher[msglen], key, nonce, &cipher_list, &aad_list);
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -156,14 +233,58 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *key, const uint8_t *nonce)
 {
     *msglen = cipherlen - CHACHA20POLY1305_TAG_BYTES;
+    iolist_t aad_list = { .iol_base = (uint8_t *)aad, .iol_len = aadlen };
+    iolist_t cipher_list = { .iol_base = (uint8_t *)cipher,
+                             .iol_len = *msglen };
     uint8_t mac[16];
-    _poly1305_gentag(mac, key, nonce, cipher,
-                     cipherlen - CHACHA20POLY1305_TAG_BYTES, aad, aadlen);
+    _poly1305_gentag(mac, key, nonce, &cipher_list, &aad_list);
     if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen);
+    _xcrypt_ctx_t ctx;
+    _xcrypt_init(&ctx, key, nonce, *msglen);
+    _xcrypt(&ctx, cipher, msg, *msglen);
+    _xcrypt_wipe(&ctx, *msglen);
+    return 1;
+}
+
+static void _xcrypt_iolist(const iolist_t *data, const uint8_t *key,
+                           const uint8_t *nonce)
+{
+    _xcrypt_ctx_t ctx;
+    size_t len = 0;
+
+    /* summed up here, so only iolist.h is needed, not the iolist module */
+    for (const iolist_t *iol = data; iol; iol = iol->iol_next) {
+        len += iol->iol_len;
+    }
+    _xcrypt_init(&ctx, key, nonce, len);
+    for (; data; data = data->iol_next) {
+        _xcrypt(&ctx, data->iol_base, data->iol_base, data->iol_len);
+    }
+    _xcrypt_wipe(&ctx, len);
+}
+
+void chacha20poly1305_encrypt_iolist(const iolist_t *data,
+                                     const iolist_t *aad,
+                                     const uint8_t *key, const uint8_t *nonce,
+                                     uint8_t *tag)
+{
+    _xcrypt_iolist(data, key, nonce);
+    _poly1305_gentag(tag, key, nonce, data, aad);
+}
+
+int chacha20poly1305_decrypt_iolist(const iolist_t *data,
+                                    const iolist_t *aad,
+                                    const uint8_t *key, const uint8_t *nonce,
+                                    const uint8_t *tag)
+{
+    uint8_t mac[CHACHA20POLY1305_TAG_BYTES];
+
+    _poly1305_gentag(mac, key, nonce, data, aad);
+    if (crypto_equals(tag, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+        return 0;
+    }
+    _xcrypt_iolist(data, key, nonce);
     return 1;
 }
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto_chacha20poly1305
+ * @{
+ *
+ * @file
+ * @brief       ChaCha20 key stream of several blocks at once with SSE2 and
+ *              AVX2
+ *
+ * Every lane of a vector computes one block, so 4 (SSE2) or 8 (AVX2)
+ * blocks are generated in parallel. Both are compiled for their instruction
+ * set extension only, so the rest of RIOT keeps running on any x86 CPU.
+ * Whether the CPU provides them is checked once at runtime.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_CHACHA20POLY1305_X86) && \
+    (defined(__i386__) || defined(__x86_64__))
+
+#include <cpuid.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/chacha20poly1305.h"
+
+#define CPU_SSE2        (1U << 0)
+#define CPU_AVX2        (1U << 1)
+#define CPU_CHECKED     (1U << 2)
+
+#define ROTL(v, n)      (((v) << (n)) | ((v) >> (32 - (n))))
+#define QR(x, a, b, c, d)                                               \
+    do {                                                                \
+        x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL(x[d], 16);              \
+        x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL(x[b], 12);              \
+        x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL(x[d], 8);               \
+        x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL(x[b], 7);               \
+    } while (0)
+#define DOUBLE_ROUND(x)                                                 \
+    do {                                                                \
+        QR(x, 0, 4, 8, 12);                                             \
+        QR(x, 1, 5, 9, 13);                                             \
+        QR(x, 2, 6, 10, 14);                                            \
+        QR(x, 3, 7, 11, 15);                                            \
+        QR(x, 0, 5, 10, 15);                                            \
+        QR(x, 1, 6, 11, 12);                                            \
+        QR(x, 2, 7, 8, 13);                                             \
+        QR(x, 3, 4, 9, 14);                                             \
+    } while (0)
+
+static unsigned _cpu;
+
+static unsigned _cpu_features(void)
+{
+    unsigned eax, ebx, ecx, edx;
+    unsigned features = CPU_CHECKED;
+
+    /* the result is always the same, so concurrent checks do no harm */
+    if (_cpu) {
+        return _cpu;
+    }
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return (_cpu = features);
+    }
+    if (edx & bit_SSE2) {
+        features |= CPU_SSE2;
+    }
+    /* the OS must save the AVX registers on context switch */
+    if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+        unsigned xcr0_lo, xcr0_hi;
+
+        __asm__ volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+        (void)xcr0_hi;
+        if (((xcr0_lo & 0x6) == 0x6) &&
+            __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+            (ebx & bit_AVX2)) {
+            features |= CPU_AVX2;
+        }
+    }
+    return (_cpu = features);
+}
+
+__attribute__((target("sse2")))
+static void _keystream_x4(uint8_t *out, const uint32_t *init, size_t numof)
+{
+    typedef uint32_t vec_t __attribute__((vector_size(16)));
+    vec_t x[16], s[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        s[i] = (vec_t){ init[i], init[i], init[i], init[i] };
+    }
+    s[12] += (vec_t){ 0, 1, 2, 3 };
+    memcpy(x, s, sizeof(x));
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLE_ROUND(x);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += s[i];
+        for (unsigned j = 0; j < numof; j++) {
+            uint32_t word = x[i][j];
+
+            memcpy(&out[(j * CHACHA20POLY1305_BLOCK_BYTES) + (i * 4)], &word,
+                   sizeof(word));
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static void _keystream_x8(uint8_t *out, const uint32_t *init, size_t numof)
+{
+    typedef uint32_t vec_t __attribute__((vector_size(32)));
+    vec_t x[16], s[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        s[i] = (vec_t){ init[i], init[i], init[i], init[i],
+                        init[i], init[i], init[i], init[i] };
+    }
+    s[12] += (vec_t){ 0, 1, 2, 3, 4, 5, 6, 7 };
+    memcpy(x, s, sizeof(x));
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLE_ROUND(x);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += s[i];
+        for (unsigned j = 0; j < numof; j++) {
+            uint32_t word = x[i][j];
+
+            memcpy(&out[(j * CHACHA20POLY1305_BLOCK_BYTES) + (i * 4)], &word,
+                   sizeof(word));
+        }
+    }
+}
+
+size_t chacha20poly1305_x86_keystream(uint8_t *out, const uint32_t *init,
+                                      size_t numof)
+{
+    unsigned cpu = _cpu_features();
+
+    /* a single block is not worth the vectors */
+    if ((cpu & CPU_AVX2) && (numof > 4)) {
+        numof = (numof > 8) ? 8 : numof;
+        _keystream_x8(out, init, numof);
+        return numof;
+    }
+    if ((cpu & CPU_SSE2) && (numof > 1)) {
+        numof = (numof > 4) ? 4 : numof;
+        _keystream_x4(out, init, numof);
+        return numof;
+    }
+    return 0;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif
@@ -39,6 +39,26 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
 }
 
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof)
+{
+    if (cipher->interface->encrypt_blocks != NULL) {
+        return cipher->interface->encrypt_blocks(&cipher->context, input,
+                                                 output, numof);
+    }
+    for (size_t i = 0; i < numof; i++) {
+        int res = cipher_encrypt(cipher, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += cipher->interface->block_size;
+        output += cipher->interface->block_size;
+    }
+    return 1;
+}
+
+
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output)
 {
@@ -19,6 +19,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
@@ -71,6 +72,53 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
 }
 
 
+/* Encrypts or decrypts the message in counter mode and computes its CBC-MAC
+ * in one pass. The CBC-MAC is sequential, so every call to the cipher
+ * encrypts the next counter block together with the pending MAC block of the
+ * previous plaintext block. Ciphers processing several blocks at once thus
+ * compute both for about the cost of one. */
+static int ccm_ctr_cbc_mac(const cipher_t *cipher, uint8_t nonce_counter[16],
+                           uint8_t nonce_len, const uint8_t *input,
+                           size_t length, uint8_t *output, uint8_t mac[16],
+                           bool decrypt)
+{
+    /* the counter (then stream) block, followed by the pending MAC block */
+    uint8_t blocks[2 * CCM_BLOCK_SIZE];
+    uint8_t *mac_block = &blocks[CCM_BLOCK_SIZE];
+    size_t offset = 0, numof = 1;
+
+    /* the MAC IV is already encrypted, so nothing is pending at first */
+    memcpy(mac_block, mac, CCM_BLOCK_SIZE);
+    while (offset < length) {
+        uint8_t block_size_input = (length - offset > CCM_BLOCK_SIZE) ?
+                                   CCM_BLOCK_SIZE : length - offset;
+
+        memcpy(blocks, nonce_counter, CCM_BLOCK_SIZE);
+        crypto_block_inc_ctr(nonce_counter, CCM_BLOCK_SIZE - nonce_len);
+        if (cipher_encrypt_blocks(cipher, blocks, blocks, numof) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+
+        for (uint8_t i = 0; i < block_size_input; ++i) {
+            uint8_t out = input[offset + i] ^ blocks[i];
+
+            /* input and output may be the same */
+            mac_block[i] ^= (decrypt) ? out : input[offset + i];
+            output[offset + i] = out;
+        }
+
+        numof = 2;
+        offset += block_size_input;
+    }
+    if ((numof == 2) &&
+        (cipher_encrypt_blocks(cipher, mac_block, mac_block, 1) != 1)) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+    memcpy(mac, mac_block, CCM_BLOCK_SIZE);
+
+    return offset;
+}
+
 static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
                              uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
                              size_t plaintext_len, uint8_t X1[16])
@@ -209,11 +257,6 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
-    }
-
     /* Compute first stream block */
     nonce_counter[0] = length_encoding - 1;
     memcpy(&nonce_counter[1], nonce,
@@ -224,10 +267,11 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    /* Encrypt message in counter mode  */
+    /* Encrypt message in counter mode and compute its MAC */
+    memcpy(mac, mac_iv, sizeof(mac));
     crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
+    len = ccm_ctr_cbc_mac(cipher, nonce_counter, nonce_len, input, input_len,
+                          output, mac, false);
     if (len < 0) {
         return len;
     }
@@ -264,39 +308,36 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
+    /* Create B0, encrypt it (X1) and use it as mac_iv */
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len,
-                                         (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Decrypt message in counter mode */
     plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
     if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
                           nonce, nonce_len, plain_len, mac_iv) < 0) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
+    /* MAC calculation (T) with additional data */
     len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
+
+    /* Compute first stream block */
+    nonce_counter[0] = length_encoding - 1;
+    memcpy(&nonce_counter[1], nonce, min(nonce_len,
+                                         (size_t)15 - length_encoding));
+    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
+                             block_size, stream_block);
+    if (len < 0) {
+        return len;
+    }
+
+    /* Decrypt message in counter mode and compute the MAC of the plaintext */
+    memcpy(mac, mac_iv, sizeof(mac));
+    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+    len = ccm_ctr_cbc_mac(cipher, nonce_counter, nonce_len, input, plain_len,
+                          plain, mac, true);
     if (len < 0) {
         return len;
     }
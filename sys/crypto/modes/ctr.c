@@ -18,32 +18,50 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
+/* number of counter blocks encrypted per call to the cipher, so ciphers
+ * processing several blocks at once can do so */
+#define CTR_BATCH_BLOCKS    (4U)
+
 int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t stream[CTR_BATCH_BLOCKS * 16], block_size;
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t numof = (length - offset + block_size - 1) / block_size;
+        size_t batch_len;
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        /* a block is encrypted even without input, so the counter is
+         * always incremented */
+        if (numof == 0) {
+            numof = 1;
+        }
+        else if (numof > CTR_BATCH_BLOCKS) {
+            numof = CTR_BATCH_BLOCKS;
+        }
+        for (size_t i = 0; i < numof; i++) {
+            memcpy(&stream[i * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        }
+        if (cipher_encrypt_blocks(cipher, stream, stream, numof) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+        batch_len = (length - offset > numof * block_size) ?
+                    numof * block_size : length - offset;
+        for (size_t i = 0; i < batch_len; ++i) {
+            output[offset + i] = stream[i] ^ input[offset + i];
         }
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        offset += batch_len;
     } while (offset < length);
 
     return offset;
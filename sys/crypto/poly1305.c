@@ -103,13 +103,31 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* complete a block of a previous update first */
+    while (ctx->c_idx && len) {
+        _take_input(ctx, *data++);
+        len--;
         if (ctx->c_idx == 16) {
             poly1305_block(ctx, 1);
             _clear_c(ctx);
         }
     }
+    if (ctx->c_idx) {
+        return;
+    }
+    /* full blocks are processed straight from the input */
+    for (; len >= POLY1305_BLOCK_SIZE; len -= POLY1305_BLOCK_SIZE) {
+        for (size_t i = 0; i < 4; i++) {
+            ctx->c[i] = u8to32(&data[4 * i]);
+        }
+        poly1305_block(ctx, 1);
+        data += POLY1305_BLOCK_SIZE;
+    }
+    _clear_c(ctx);
+    /* keep the rest for the next update */
+    for (size_t i = 0; i < len; i++) {
+        _take_input(ctx, data[i]);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
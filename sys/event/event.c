@@ -33,13 +33,121 @@
 #include "xtimer.h"
 #endif
 
+#if IS_USED(MODULE_EVENT_PRIO)
+static_assert(CONFIG_EVENT_PRIO_NUMOF >= 2,
+              "CONFIG_EVENT_PRIO_NUMOF must be at least 2");
+#endif
+
+/* list of the priority class of event in queue */
+static inline clist_node_t *_list(event_queue_t *queue, const event_t *event)
+{
+#if IS_USED(MODULE_EVENT_PRIO)
+    assert(event->prio < CONFIG_EVENT_PRIO_NUMOF);
+    if (event->prio) {
+        return &queue->prio_lists[event->prio - 1];
+    }
+#else
+    (void)event;
+#endif
+    return &queue->event_list;
+}
+
+/* Like the clist, list->next points to the last event, whose next is the
+ * first. With event_dlist, the events additionally point to their
+ * predecessor, so any event can be unlinked without a search. */
+static inline void _push(clist_node_t *list, event_t *event)
+{
+#if IS_USED(MODULE_EVENT_DLIST)
+    clist_node_t *last = list->next;
+
+    if (last) {
+        event_t *first = container_of(last->next, event_t, list_node);
+
+        event->list_node.next = &first->list_node;
+        event->list_prev = last;
+        last->next = &event->list_node;
+        first->list_prev = &event->list_node;
+    }
+    else {
+        event->list_node.next = &event->list_node;
+        event->list_prev = &event->list_node;
+    }
+    list->next = &event->list_node;
+#else
+    clist_rpush(list, &event->list_node);
+#endif
+}
+
+static inline event_t *_pop_list(clist_node_t *list)
+{
+#if IS_USED(MODULE_EVENT_DLIST)
+    clist_node_t *last = list->next;
+    event_t *first;
+
+    if (last == NULL) {
+        return NULL;
+    }
+    first = container_of(last->next, event_t, list_node);
+    if (&first->list_node == last) {
+        list->next = NULL;
+    }
+    else {
+        event_t *second = container_of(first->list_node.next, event_t,
+                                       list_node);
+
+        last->next = &second->list_node;
+        second->list_prev = last;
+    }
+    return first;
+#else
+    return container_of(clist_lpop(list), event_t, list_node);
+#endif
+}
+
+static inline void _remove(clist_node_t *list, event_t *event)
+{
+#if IS_USED(MODULE_EVENT_DLIST)
+    if (event->list_node.next == NULL) {
+        return;
+    }
+    if (event->list_node.next == &event->list_node) {
+        list->next = NULL;
+    }
+    else {
+        event_t *next = container_of(event->list_node.next, event_t,
+                                     list_node);
+
+        event->list_prev->next = &next->list_node;
+        next->list_prev = event->list_prev;
+        if (list->next == &event->list_node) {
+            list->next = event->list_prev;
+        }
+    }
+#else
+    clist_remove(list, &event->list_node);
+#endif
+}
+
+/* takes the first event of the highest priority class */
+static inline event_t *_pop(event_queue_t *queue)
+{
+#if IS_USED(MODULE_EVENT_PRIO)
+    for (unsigned i = CONFIG_EVENT_PRIO_NUMOF - 1; i > 0; i--) {
+        if (queue->prio_lists[i - 1].next) {
+            return _pop_list(&queue->prio_lists[i - 1]);
+        }
+    }
+#endif
+    return _pop_list(&queue->event_list);
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
     unsigned state = irq_disable();
     if (!event->list_node.next) {
-        clist_rpush(&queue->event_list, &event->list_node);
+        _push(_list(queue, event), event);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -55,7 +163,7 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    _remove(_list(queue, event), event);
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -63,7 +171,7 @@ void event_cancel(event_queue_t *queue, event_t *event)
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = _pop(queue);
     irq_restore(state);
 
     if (result) {
@@ -80,8 +188,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     do {
         unsigned state = irq_disable();
         for (size_t i = 0; i < n_queues; i++) {
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+            result = _pop(&queues[i]);
             if (result) {
                 break;
             }
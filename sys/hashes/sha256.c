@@ -45,9 +45,11 @@
  * @}
  */
 
+#include <stdint.h>
 #include <string.h>
 #include <assert.h>
 
+#include "kernel_defines.h"
 #include "hashes/sha256.h"
 #include "hashes/sha2xx_common.h"
 
@@ -85,6 +87,41 @@ void *sha256(const void *data, size_t len, void *digest)
     return digest;
 }
 
+void sha256_multi(const void *const data[], const size_t len[],
+                  void *const digest[], unsigned numof)
+{
+#if IS_USED(MODULE_HASHES_SHA2XX_X86)
+    for (; numof >= SHA2XX_X86_LANES; numof -= SHA2XX_X86_LANES) {
+        sha256_context_t c[SHA2XX_X86_LANES];
+        sha2xx_context_t *ctx[SHA2XX_X86_LANES];
+        size_t blocks = SIZE_MAX;
+
+        /* hash the complete blocks all buffers have in parallel ... */
+        for (unsigned i = 0; i < SHA2XX_X86_LANES; i++) {
+            sha256_init(&c[i]);
+            ctx[i] = &c[i];
+            if ((len[i] / SHA256_INTERNAL_BLOCK_SIZE) < blocks) {
+                blocks = len[i] / SHA256_INTERNAL_BLOCK_SIZE;
+            }
+        }
+        sha2xx_update_multi(ctx, data, blocks, SHA2XX_X86_LANES);
+        /* ... and the rest of each one after another */
+        for (unsigned i = 0; i < SHA2XX_X86_LANES; i++) {
+            size_t done = blocks * SHA256_INTERNAL_BLOCK_SIZE;
+
+            sha2xx_update(&c[i], (const uint8_t *)data[i] + done,
+                          len[i] - done);
+            sha256_final(&c[i], digest[i]);
+        }
+        data += SHA2XX_X86_LANES;
+        len += SHA2XX_X86_LANES;
+        digest += SHA2XX_X86_LANES;
+    }
+#endif
+    for (unsigned i = 0; i < numof; i++) {
+        sha256(data[i], len[i], digest[i]);
+    }
+}
 
 void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
 {
@@ -49,6 +49,7 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "kernel_defines.h"
 #include "hashes/sha2xx_common.h"
 
 
@@ -97,6 +98,66 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#if IS_USED(MODULE_HASHES_SHA2XX_UNROLLED)
+/* One round with the working variables rotated by the caller, so no variable
+ * has to be moved; W[k] holds the message schedule word of round i + k. */
+#define RND(a, b, c, d, e, f, g, h, i, k)                           \
+    do {                                                            \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[k] + K[(i) + (k)]; \
+        d += t0;                                                    \
+        h = t0 + S0(a) + Maj(a, b, c);                              \
+    } while (0)
+
+/*
+ * SHA256 block compression function.  The 256-bit state is transformed via
+ * the 512-bit input block to produce a new state.
+ *
+ * Sixteen rounds are unrolled, so the working variables and the message
+ * schedule, which is kept in a 16 word window, are indexed with constants.
+ */
+static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+{
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    be32dec_vect(W, block, 64);
+    for (unsigned i = 0; i < 64; i += 16) {
+        if (i > 0) {
+            /* W[k] becomes the schedule word of round i + k */
+            for (unsigned k = 0; k < 16; k++) {
+                W[k] += s1(W[(k + 14) & 15]) + W[(k + 9) & 15] +
+                        s0(W[(k + 1) & 15]);
+            }
+        }
+        RND(a, b, c, d, e, f, g, h, i, 0);
+        RND(h, a, b, c, d, e, f, g, i, 1);
+        RND(g, h, a, b, c, d, e, f, i, 2);
+        RND(f, g, h, a, b, c, d, e, i, 3);
+        RND(e, f, g, h, a, b, c, d, i, 4);
+        RND(d, e, f, g, h, a, b, c, i, 5);
+        RND(c, d, e, f, g, h, a, b, i, 6);
+        RND(b, c, d, e, f, g, h, a, i, 7);
+        RND(a, b, c, d, e, f, g, h, i, 8);
+        RND(h, a, b, c, d, e, f, g, i, 9);
+        RND(g, h, a, b, c, d, e, f, i, 10);
+        RND(f, g, h, a, b, c, d, e, i, 11);
+        RND(e, f, g, h, a, b, c, d, i, 12);
+        RND(d, e, f, g, h, a, b, c, i, 13);
+        RND(c, d, e, f, g, h, a, b, i, 14);
+        RND(b, c, d, e, f, g, h, a, i, 15);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+#else /* IS_USED(MODULE_HASHES_SHA2XX_UNROLLED) */
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -134,6 +195,22 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         state[i] += S[i];
     }
 }
+#endif /* IS_USED(MODULE_HASHES_SHA2XX_UNROLLED) */
+
+/* Compress consecutive blocks with the fastest available implementation */
+static void sha2xx_transform_blocks(uint32_t *state, const unsigned char *block,
+                                    size_t blocks)
+{
+#if IS_USED(MODULE_HASHES_SHA2XX_X86)
+    if (sha2xx_x86_transform(state, block, blocks)) {
+        return;
+    }
+#endif
+    while (blocks--) {
+        sha2xx_transform(state, block);
+        block += 64;
+    }
+}
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -162,12 +239,9 @@ void sha2xx_pad(sha2xx_context_t *ctx)
     sha2xx_update(ctx, len, 8);
 }
 
-/* Add bytes into the hash */
-void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
+/* Add the number of bytes to the processed bits counter */
+static void sha2xx_count(sha2xx_context_t *ctx, size_t len)
 {
-    /* Number of bytes left in the buffer from previous updates */
-    uint32_t r = (ctx->count[1] >> 3) & 0x3f;
-
     /* Convert the length into a number of bits */
     uint32_t bitlen1 = ((uint32_t) len) << 3;
     uint32_t bitlen0 = ((uint32_t) len) >> 29;
@@ -178,6 +252,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     }
 
     ctx->count[0] += bitlen0;
+}
+
+/* Add bytes into the hash */
+void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
+{
+    /* Number of bytes left in the buffer from previous updates */
+    uint32_t r = (ctx->count[1] >> 3) & 0x3f;
+
+    sha2xx_count(ctx, len);
 
     /* Handle the case where we don't need to perform any transforms */
     if (len < 64 - r) {
@@ -191,21 +274,49 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
-    }
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~((size_t)0x3f);
+    len &= 0x3f;
 
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
 }
 
+/* Add the same number of complete blocks into several hashes */
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], size_t blocks,
+                         unsigned numof)
+{
+    unsigned i = 0;
+
+#if IS_USED(MODULE_HASHES_SHA2XX_X86)
+    for (; (numof - i) >= SHA2XX_X86_LANES; i += SHA2XX_X86_LANES) {
+        uint32_t *state[SHA2XX_X86_LANES];
+
+        for (unsigned j = 0; j < SHA2XX_X86_LANES; j++) {
+            /* the buffers must be empty */
+            assert(!(ctx[i + j]->count[1] & 0x1ff));
+            state[j] = ctx[i + j]->state;
+        }
+        if (!sha2xx_x86_transform_x8(state, &data[i], blocks)) {
+            break;
+        }
+        for (unsigned j = 0; j < SHA2XX_X86_LANES; j++) {
+            sha2xx_count(ctx[i + j], blocks * 64);
+        }
+    }
+#endif
+    for (; i < numof; i++) {
+        assert(!(ctx[i]->count[1] & 0x1ff));
+        sha2xx_update(ctx[i], data[i], blocks * 64);
+    }
+}
+
 /*
  * SHA-224 finalization.  Pads the input data, exports the hash value,
  * and clears the context state.
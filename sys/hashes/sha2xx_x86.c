@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes
+ * @{
+ *
+ * @file
+ * @brief       SHA-2XX block compression using x86 SHA extensions and AVX2
+ *
+ * Both implementations are compiled for their instruction set extension
+ * only, so the rest of RIOT keeps running on any x86 CPU. Whether the CPU
+ * provides them is checked once at runtime.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_HASHES_SHA2XX_X86) && \
+    (defined(__i386__) || defined(__x86_64__))
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hashes/sha2xx_common.h"
+
+#define CPU_SHA         (1U << 0)
+#define CPU_AVX2        (1U << 1)
+#define CPU_CHECKED     (1U << 2)
+
+static unsigned _cpu;
+
+static unsigned _cpu_features(void)
+{
+    unsigned eax, ebx, ecx, edx;
+    unsigned features = CPU_CHECKED;
+
+    /* the result is always the same, so concurrent checks do no harm */
+    if (_cpu) {
+        return _cpu;
+    }
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return (_cpu = features);
+    }
+    /* SSSE3 and SSE4.1 are needed besides the SHA extensions */
+    bool sse = (ecx & bit_SSSE3) && (ecx & bit_SSE4_1);
+    /* the OS must save the AVX registers on context switch */
+    bool avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX);
+
+    if (avx) {
+        unsigned xcr0_lo, xcr0_hi;
+
+        __asm__ volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+        (void)xcr0_hi;
+        avx = ((xcr0_lo & 0x6) == 0x6);
+    }
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        if (sse && (ebx & bit_SHA)) {
+            features |= CPU_SHA;
+        }
+        if (avx && (ebx & bit_AVX2)) {
+            features |= CPU_AVX2;
+        }
+    }
+    return (_cpu = features);
+}
+
+__attribute__((target("sha,sse4.1")))
+static void _transform_sha(uint32_t *state, const uint8_t *data, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i abef, cdgh, tmp, msg, w[4];
+
+    /* the SHA instructions keep the state as ABEF and CDGH */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    while (blocks--) {
+        __m128i abef_save = abef, cdgh_save = cdgh;
+
+        /* four rounds per iteration, w[j % 4] holds their schedule words;
+         * unrolled, so the array and the branches are resolved at compile
+         * time */
+#pragma GCC unroll 16
+        for (unsigned j = 0; j < 16; j++) {
+            __m128i *cur = &w[j % 4], *next = &w[(j + 1) % 4];
+            __m128i *prev = &w[(j + 3) % 4];
+
+            if (j < 4) {
+                *cur = _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i *)&data[j * 16]), bswap);
+            }
+            msg = _mm_add_epi32(*cur,
+                                _mm_loadu_si128((const __m128i *)&K[j * 4]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, msg);
+            if ((j >= 3) && (j < 15)) {
+                /* finish the schedule words of the next four rounds */
+                tmp = _mm_alignr_epi8(*cur, *prev, 4);
+                *next = _mm_sha256msg2_epu32(_mm_add_epi32(*next, tmp), *cur);
+            }
+            msg = _mm_shuffle_epi32(msg, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, msg);
+            if ((j >= 1) && (j < 13)) {
+                /* start the schedule words of the rounds after next */
+                *prev = _mm_sha256msg1_epu32(*prev, *cur);
+            }
+        }
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+bool sha2xx_x86_transform(uint32_t *state, const void *data, size_t blocks)
+{
+    if (!(_cpu_features() & CPU_SHA)) {
+        return false;
+    }
+    if (blocks) {
+        _transform_sha(state, data, blocks);
+    }
+    return true;
+}
+
+/* Elementary functions of SHA2XX on eight 32 bit lanes */
+#define V_ROTR(x, n)    _mm256_or_si256(_mm256_srli_epi32(x, n), \
+                                        _mm256_slli_epi32(x, 32 - (n)))
+#define V_XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256(x, y), z)
+#define V_ADD(x, y)     _mm256_add_epi32(x, y)
+#define V_CH(x, y, z)   _mm256_xor_si256(_mm256_and_si256(x, \
+                                         _mm256_xor_si256(y, z)), z)
+#define V_MAJ(x, y, z)  _mm256_or_si256(_mm256_and_si256(x, \
+                                        _mm256_or_si256(y, z)), \
+                                        _mm256_and_si256(y, z))
+#define V_S0(x)         V_XOR3(V_ROTR(x, 2), V_ROTR(x, 13), V_ROTR(x, 22))
+#define V_S1(x)         V_XOR3(V_ROTR(x, 6), V_ROTR(x, 11), V_ROTR(x, 25))
+#define V_s0(x)         V_XOR3(V_ROTR(x, 7), V_ROTR(x, 18), \
+                               _mm256_srli_epi32(x, 3))
+#define V_s1(x)         V_XOR3(V_ROTR(x, 17), V_ROTR(x, 19), \
+                               _mm256_srli_epi32(x, 10))
+
+static inline uint32_t _load_be32(const uint8_t *data)
+{
+    uint32_t word;
+
+    memcpy(&word, data, sizeof(word));
+    return __builtin_bswap32(word);
+}
+
+__attribute__((target("avx2")))
+static void _transform_avx2(uint32_t *const state[], const uint8_t *data[],
+                            size_t blocks)
+{
+    /* s[i] holds the state word i of all lanes */
+    __m256i s[8];
+
+    for (unsigned i = 0; i < 8; i++) {
+        s[i] = _mm256_set_epi32(state[7][i], state[6][i], state[5][i],
+                                state[4][i], state[3][i], state[2][i],
+                                state[1][i], state[0][i]);
+    }
+    while (blocks--) {
+        __m256i w[16];
+        __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+        __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+
+        for (unsigned i = 0; i < 16; i++) {
+            w[i] = _mm256_set_epi32(_load_be32(&data[7][i * 4]),
+                                    _load_be32(&data[6][i * 4]),
+                                    _load_be32(&data[5][i * 4]),
+                                    _load_be32(&data[4][i * 4]),
+                                    _load_be32(&data[3][i * 4]),
+                                    _load_be32(&data[2][i * 4]),
+                                    _load_be32(&data[1][i * 4]),
+                                    _load_be32(&data[0][i * 4]));
+        }
+        for (unsigned i = 0; i < 64; i++) {
+            __m256i t0, t1;
+
+            if (i >= 16) {
+                w[i & 15] = V_ADD(V_ADD(w[i & 15], V_s1(w[(i + 14) & 15])),
+                                  V_ADD(w[(i + 9) & 15],
+                                        V_s0(w[(i + 1) & 15])));
+            }
+            t0 = V_ADD(V_ADD(h, V_S1(e)),
+                       V_ADD(V_CH(e, f, g),
+                             V_ADD(w[i & 15], _mm256_set1_epi32(K[i]))));
+            t1 = V_ADD(V_S0(a), V_MAJ(a, b, c));
+            h = g;
+            g = f;
+            f = e;
+            e = V_ADD(d, t0);
+            d = c;
+            c = b;
+            b = a;
+            a = V_ADD(t0, t1);
+        }
+        s[0] = V_ADD(s[0], a);
+        s[1] = V_ADD(s[1], b);
+        s[2] = V_ADD(s[2], c);
+        s[3] = V_ADD(s[3], d);
+        s[4] = V_ADD(s[4], e);
+        s[5] = V_ADD(s[5], f);
+        s[6] = V_ADD(s[6], g);
+        s[7] = V_ADD(s[7], h);
+        for (unsigned j = 0; j < SHA2XX_X86_LANES; j++) {
+            data[j] += 64;
+        }
+    }
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t lanes[SHA2XX_X86_LANES];
+
+        _mm256_storeu_si256((__m256i *)lanes, s[i]);
+        for (unsigned j = 0; j < SHA2XX_X86_LANES; j++) {
+            state[j][i] = lanes[j];
+        }
+    }
+}
+
+bool sha2xx_x86_transform_x8(uint32_t *const state[],
+                             const void *const data[], size_t blocks)
+{
+    const uint8_t *src[SHA2XX_X86_LANES];
+
+    /* one SHA extensions hash after another is faster than eight in
+     * parallel with AVX2 */
+    if ((_cpu_features() & (CPU_AVX2 | CPU_SHA)) != CPU_AVX2) {
+        return false;
+    }
+    for (unsigned i = 0; i < SHA2XX_X86_LANES; i++) {
+        src[i] = data[i];
+    }
+    if (blocks) {
+        _transform_avx2(state, src, blocks);
+    }
+    return true;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif
@@ -10,6 +10,30 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_FUNC times a loop of function calls once and prints the
+ * average runtime per call in a human-readable form.
+ *
+ * For comparing the performance of changes, @ref BENCHMARK_SAMPLES should be
+ * used instead: It runs a number of warmup samples that are discarded, before
+ * it takes the given number of samples. Each sample times a loop of function
+ * calls with the finest counter available on the platform:
+ *
+ * - the DWT cycle counter (`DWT->CYCCNT`) on Cortex-M3/M33/M4/M7, unit
+ *   `cycles`
+ * - `clock_gettime()` with `CLOCK_MONOTONIC` on `native`, unit `ns`
+ * - @ref xtimer_now_usec() on all other platforms, unit `us`
+ *
+ * The minimum, median, 99th percentile, maximum, and mean of the samples are
+ * printed as one JSON object per line, so they can be collected by
+ * `dist/tools/benchmark/benchmark.py`:
+ *
+ *     { "name" : "mutex lock/unlock", "unit" : "cycles", "runs" : 100, "samples" : 50, "min" : 5200, "median" : 5200, "p99" : 5230, "max" : 5230, "mean" : 5204 }
+ *
+ * All values are the time of one sample, i.e. of `runs` calls. As the
+ * counters are 32 bits wide, a sample must finish before they wrap around
+ * (e.g. after 4.29 s on `native` or 67 s for the cycle counter at 64 MHz).
+ *
  * @{
  *
  * @file
@@ -21,11 +45,24 @@
 #ifndef BENCHMARK_H
 #define BENCHMARK_H
 
+#include <assert.h>
 #include <stdint.h>
 
 #include "irq.h"
 #include "xtimer.h"
 
+#if defined(CPU_CORE_CORTEX_M3) || defined(CPU_CORE_CORTEX_M33) || \
+    defined(CPU_CORE_CORTEX_M4) || defined(CPU_CORE_CORTEX_M4F) || \
+    defined(CPU_CORE_CORTEX_M7)
+#include "cpu.h"
+/**
+ * @brief   The DWT cycle counter is used for @ref benchmark_cycles_now()
+ */
+#define BENCHMARK_CYCLES_DWT    (1)
+#elif defined(CPU_NATIVE)
+#include <time.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -51,6 +88,122 @@ extern "C" {
         benchmark_print_time(_benchmark_time, runs, name);      \
     }
 
+/**
+ * @brief   Maximum number of samples of @ref BENCHMARK_SAMPLES
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES_MAX
+#define CONFIG_BENCHMARK_SAMPLES_MAX    (100U)
+#endif
+
+/**
+ * @brief   Unit of @ref benchmark_cycles_now()
+ */
+#if defined(BENCHMARK_CYCLES_DWT)
+#define BENCHMARK_CYCLES_UNIT   "cycles"
+#elif defined(CPU_NATIVE)
+#define BENCHMARK_CYCLES_UNIT   "ns"
+#else
+#define BENCHMARK_CYCLES_UNIT   "us"
+#endif
+
+/**
+ * @brief   Statistics over the samples of a benchmark
+ */
+typedef struct {
+    uint32_t min;       /**< Fastest sample */
+    uint32_t median;    /**< Median of the samples */
+    uint32_t p99;       /**< 99th percentile of the samples */
+    uint32_t max;       /**< Slowest sample */
+    uint32_t mean;      /**< Arithmetic mean of the samples */
+} benchmark_stats_t;
+
+/**
+ * @brief   Sample buffer used by @ref BENCHMARK_SAMPLES
+ */
+extern uint32_t benchmark_samples[CONFIG_BENCHMARK_SAMPLES_MAX];
+
+/**
+ * @brief   Starts the counter of @ref benchmark_cycles_now()
+ *
+ * Is called by @ref BENCHMARK_SAMPLES, but may be called more than once.
+ */
+void benchmark_cycles_init(void);
+
+/**
+ * @brief   Reads the finest counter of the platform
+ *
+ * @return  Current counter value in @ref BENCHMARK_CYCLES_UNIT.
+ */
+static inline uint32_t benchmark_cycles_now(void)
+{
+#if defined(BENCHMARK_CYCLES_DWT)
+    return DWT->CYCCNT;
+#elif defined(CPU_NATIVE)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * NS_PER_SEC) + ts.tv_nsec);
+#else
+    return xtimer_now_usec();
+#endif
+}
+
+/**
+ * @brief   Measure the runtime of a given function call in several samples
+ *
+ * Runs @p warmup samples that are discarded and then takes @p samples
+ * samples of @p runs calls of @p func each. Their statistics are printed as
+ * JSON with @ref benchmark_print_stats().
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] warmup    number of samples to discard
+ * @param[in] samples   number of samples, at most
+ *                      @ref CONFIG_BENCHMARK_SAMPLES_MAX
+ * @param[in] runs      number of times to run @p func per sample
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_SAMPLES(name, warmup, samples, runs, func)                \
+    {                                                                       \
+        benchmark_stats_t _benchmark_stats;                                 \
+        assert(((samples) > 0) &&                                           \
+               ((samples) <= CONFIG_BENCHMARK_SAMPLES_MAX));                \
+        benchmark_cycles_init();                                            \
+        for (unsigned _benchmark_s = 0; _benchmark_s < (warmup) + (samples);\
+             _benchmark_s++) {                                              \
+            uint32_t _benchmark_time = benchmark_cycles_now();              \
+            for (unsigned long i = 0; i < (runs); i++) {                    \
+                func;                                                       \
+            }                                                               \
+            _benchmark_time = benchmark_cycles_now() - _benchmark_time;     \
+            if (_benchmark_s >= (warmup)) {                                 \
+                benchmark_samples[_benchmark_s - (warmup)] = _benchmark_time;\
+            }                                                               \
+        }                                                                   \
+        benchmark_stats(benchmark_samples, (samples), &_benchmark_stats);   \
+        benchmark_print_stats(name, (runs), (samples), &_benchmark_stats);  \
+    }
+
+/**
+ * @brief   Calculates the statistics over a number of samples
+ *
+ * @param[in,out] samples   the samples, will be sorted
+ * @param[in] numof         number of @p samples, must not be 0
+ * @param[out] stats        the statistics over @p samples
+ */
+void benchmark_stats(uint32_t *samples, unsigned numof,
+                     benchmark_stats_t *stats);
+
+/**
+ * @brief   Output the statistics of a benchmark as JSON on STDIO
+ *
+ * @param[in] name      name to label the output
+ * @param[in] runs      number of runs per sample
+ * @param[in] numof     number of samples
+ * @param[in] stats     statistics over the samples
+ */
+void benchmark_print_stats(const char *name, unsigned long runs,
+                           unsigned numof, const benchmark_stats_t *stats);
+
 /**
  * @brief   Output the given time as well as the time per run on STDIO
  *
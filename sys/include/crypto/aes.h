@@ -13,6 +13,18 @@
  * @file
  * @brief       Headers for the implementation of the AES cipher-algorithm
  *
+ * The implementation is selected at build time:
+ *
+ * - By default, AES is computed with lookup tables. This is fast, but the
+ *   tables need several KiB of ROM and the timing of the table lookups
+ *   depends on the key and data in caches.
+ * - The `crypto_aes_ct` module uses a bitsliced implementation without any
+ *   lookup table, so its timing does not depend on secrets. It keeps the
+ *   expanded key in the context, which grows the @ref cipher_context_t to
+ *   176 bytes.
+ * - The `crypto_aes_x86` module (`native` only) additionally uses AES-NI,
+ *   if the CPU supports it.
+ *
  * @author      Freie Universitaet Berlin, Computer Systems & Telematics
  * @author      Nicolai Schmittberger <nicolai.schmittberger@fu-berlin.de>
  * @author      Fabrice Bellard
@@ -26,7 +38,9 @@
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "crypto/ciphers.h"
 
 #ifdef __cplusplus
@@ -106,6 +120,28 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts several independent blocks at once
+ *
+ * The table-based implementation expands the key only once for all blocks,
+ * the constant-time implementation processes two blocks in parallel, and
+ * AES-NI processes four.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       input         a pointer to @p numof plaintext-blocks
+ * @param       output        a pointer to the place where the @p numof
+ *                            ciphertext-blocks will be stored, may be the
+ *                            same as @p input
+ * @param       numof         the number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -126,6 +162,48 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+#if IS_USED(MODULE_CRYPTO_AES_X86) || defined(DOXYGEN)
+/**
+ * @brief   Checks if the CPU supports AES-NI
+ *
+ * @note    Only available with the `crypto_aes_x86` module. If this returns
+ *          false, the constant-time implementation is used.
+ */
+bool aes_x86_supported(void);
+
+/**
+ * @brief   Expands the key into the AES-NI key schedule
+ *
+ * @pre     @ref aes_x86_supported()
+ *
+ * @param       context       the cipher_context_t-struct to store the key
+ *                            schedule in
+ * @param       key           the key of AES_KEY_SIZE bytes
+ */
+void aes_x86_init(cipher_context_t *context, const uint8_t *key);
+
+/**
+ * @brief   Encrypts blocks with AES-NI
+ *
+ * @pre     @ref aes_x86_supported()
+ *
+ * @see     aes_encrypt_blocks()
+ */
+void aes_x86_encrypt_blocks(const cipher_context_t *context,
+                            const uint8_t *input, uint8_t *output,
+                            size_t numof);
+
+/**
+ * @brief   Decrypts a block with AES-NI
+ *
+ * @pre     @ref aes_x86_supported()
+ *
+ * @see     aes_decrypt()
+ */
+void aes_x86_decrypt(const cipher_context_t *context,
+                     const uint8_t *cipher_block, uint8_t *plain_block);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
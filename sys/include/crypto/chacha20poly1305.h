@@ -17,6 +17,16 @@
  * Nonces must be unique per message for a single key. They are allowed to be
  * predictable, e.g. a message counter and are allowed to be visible during
  * transmission.
+ *
+ * Besides contiguous buffers, @ref chacha20poly1305_encrypt_iolist() and
+ * @ref chacha20poly1305_decrypt_iolist() work in place on scattered data,
+ * e.g. the snips of a packet, so it does not have to be copied into one
+ * buffer first.
+ *
+ * The key stream is generated for up to
+ * @ref CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS blocks at once. With the
+ * `crypto_chacha20poly1305_x86` module (`native` only), 4 or 8 blocks are
+ * computed in parallel with SSE2 or AVX2, if the CPU supports it.
  * @{
  *
  * @file
@@ -28,7 +38,12 @@
 #ifndef CRYPTO_CHACHA20POLY1305_H
 #define CRYPTO_CHACHA20POLY1305_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "crypto/poly1305.h"
+#include "iolist.h"
+#include "kernel_defines.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +52,21 @@ extern "C" {
 #define CHACHA20POLY1305_KEY_BYTES      (32U)   /**< Key length in bytes */
 #define CHACHA20POLY1305_NONCE_BYTES    (12U)   /**< Nonce length in bytes */
 #define CHACHA20POLY1305_TAG_BYTES      (16U)   /**< Tag length in bytes */
+#define CHACHA20POLY1305_BLOCK_BYTES    (64U)   /**< Block length in bytes */
+
+/**
+ * @brief   Number of key stream blocks generated at once
+ *
+ * The key stream is buffered on the stack, so this costs
+ * @ref CHACHA20POLY1305_BLOCK_BYTES bytes of stack per block.
+ */
+#ifndef CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS
+#if IS_USED(MODULE_CRYPTO_CHACHA20POLY1305_X86)
+#define CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS   (8U)
+#else
+#define CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS   (1U)
+#endif
+#endif
 
 /**
  * @brief Chacha20poly1305 state struct
@@ -96,6 +126,68 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce);
 
+/**
+ * @brief Encrypt scattered data in place and compute the tag over the
+ * ciphertext and additional data.
+ *
+ * The entries of @p data and @p aad may have any length, the result is the
+ * same as of @ref chacha20poly1305_encrypt() on the concatenated entries.
+ *
+ * @param[in,out] data      message to encrypt, replaced by the ciphertext
+ * @param[in]   aad         additional authenticated data to protect, may be
+ *                          NULL
+ * @param[in]   key         key to encrypt with, must be
+ *                          CHACHA20POLY1305_KEY_BYTES long
+ * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
+ *                          long
+ * @param[out]  tag         resulting tag, must be CHACHA20POLY1305_TAG_BYTES
+ *                          long
+ */
+void chacha20poly1305_encrypt_iolist(const iolist_t *data,
+                                     const iolist_t *aad,
+                                     const uint8_t *key, const uint8_t *nonce,
+                                     uint8_t *tag);
+
+/**
+ * @brief Verify the tag and decrypt scattered data in place.
+ *
+ * @param[in,out] data      ciphertext to decrypt without the tag, replaced by
+ *                          the message if the tag is valid
+ * @param[in]   aad         additional authenticated data to verify, may be
+ *                          NULL
+ * @param[in]   key         key to decrypt with, must be
+ *                          CHACHA20POLY1305_KEY_BYTES long
+ * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
+ *                          long
+ * @param[in]   tag         tag to verify, must be CHACHA20POLY1305_TAG_BYTES
+ *                          long
+ *
+ * @return  1 if the tag is valid and @p data was decrypted
+ * @return  0 if the tag is invalid, @p data is left untouched then
+ */
+int chacha20poly1305_decrypt_iolist(const iolist_t *data,
+                                    const iolist_t *aad,
+                                    const uint8_t *key, const uint8_t *nonce,
+                                    const uint8_t *tag);
+
+#if IS_USED(MODULE_CRYPTO_CHACHA20POLY1305_X86) || defined(DOXYGEN)
+/**
+ * @brief   Generates key stream blocks with SSE2 or AVX2
+ *
+ * @note    Only available with the `crypto_chacha20poly1305_x86` module.
+ *
+ * @param[out]  out     key stream of @p numof blocks at most
+ * @param[in]   init    initial state of the first block, the block counter
+ *                      of the following blocks is incremented
+ * @param[in]   numof   number of blocks requested
+ *
+ * @return  number of blocks generated, 0 if the CPU supports neither or
+ *          @p numof is too small to be worth the vectors
+ */
+size_t chacha20poly1305_x86_keystream(uint8_t *out, const uint32_t *init,
+                                      size_t numof);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,10 +39,13 @@ extern "C" {
  * Context sizes needed for the different ciphers.
  * Always order by number of bytes descending!!! <br><br>
  *
+ * aes_ct       needs 176 bytes (expanded key)            <br>
  * threedes     needs 24  bytes                           <br>
  * aes          needs CIPHERS_MAX_KEY_SIZE bytes          <br>
  */
-#if defined(MODULE_CRYPTO_3DES)
+#if defined(MODULE_CRYPTO_AES_CT)
+    #define CIPHER_MAX_CONTEXT_SIZE 176
+#elif defined(MODULE_CRYPTO_3DES)
     #define CIPHER_MAX_CONTEXT_SIZE 24
 #elif defined(MODULE_CRYPTO_AES)
     #define CIPHER_MAX_CONTEXT_SIZE CIPHERS_MAX_KEY_SIZE
@@ -89,6 +93,11 @@ typedef struct cipher_interface_st {
     /** the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /** the function to encrypt several independent blocks at once
+     *  (may be NULL, see @ref cipher_encrypt_blocks()) */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t numof);
 } cipher_interface_t;
 
 
@@ -145,6 +154,28 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt several independent blocks of BLOCK_SIZE length
+ *
+ * Other than calling @ref cipher_encrypt() for every block, this allows the
+ * cipher to prepare the key only once and to process several blocks in
+ * parallel. Modes of operation use this for blocks that do not depend on
+ * each other, e.g. the key stream of the counter mode.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt, @p numof blocks of
+ *                   BLOCK_SIZE
+ * @param output     pointer to allocated memory for encrypted data, @p numof
+ *                   blocks of BLOCK_SIZE. May be the same as @p input.
+ * @param numof      number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
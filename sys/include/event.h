@@ -84,6 +84,21 @@
  * [...] event_post(&queue, &custom_event)
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Two optional modules change how events are queued:
+ *
+ * - `event_dlist`: each event also points to its predecessor in the queue,
+ *   so @ref event_cancel() runs in O(1) instead of O(n). This costs one
+ *   pointer per event.
+ * - `event_prio`: each event has a priority class @ref event_t::prio, which
+ *   must not be changed while the event is queued. A queue keeps one FIFO
+ *   per class, and events of a higher class are always taken first. The
+ *   default class 0 is the lowest. An urgent event thus does not wait
+ *   behind bulk work posted to the same queue:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_t rx_event = { .handler = rx_handler, .prio = 1 };
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * @{
  *
  * @file
@@ -96,12 +111,14 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "assert.h"
 #include "clist.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "thread.h"
 #include "thread_flags.h"
 #include "ptrtag.h"
@@ -110,6 +127,19 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup    sys_event_conf Event queue compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of priority classes of the `event_prio` module
+ */
+#ifndef CONFIG_EVENT_PRIO_NUMOF
+#define CONFIG_EVENT_PRIO_NUMOF     (2U)
+#endif
+/** @} */
+
 #ifndef THREAD_FLAG_EVENT
 /**
  * @brief   Thread flag use to notify available events in an event queue
@@ -143,13 +173,29 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+#if IS_USED(MODULE_EVENT_DLIST) || defined(DOXYGEN)
+    clist_node_t *list_prev;    /**< previous event in the queue
+                                     (only with `event_dlist`)          */
+#endif
+#if IS_USED(MODULE_EVENT_PRIO) || defined(DOXYGEN)
+    uint8_t prio;               /**< priority class, higher is more
+                                     urgent (only with `event_prio`)    */
+#endif
 };
 
 /**
  * @brief   event queue structure
  */
 typedef struct PTRTAG {
-    clist_node_t event_list;    /**< list of queued events              */
+    clist_node_t event_list;    /**< list of queued events (of priority
+                                     class 0 with `event_prio`)         */
+#if IS_USED(MODULE_EVENT_PRIO) || defined(DOXYGEN)
+    /**
+     * @brief   lists of queued events of the priority classes 1 to
+     *          @ref CONFIG_EVENT_PRIO_NUMOF - 1 (only with `event_prio`)
+     */
+    clist_node_t prio_lists[CONFIG_EVENT_PRIO_NUMOF - 1];
+#endif
     thread_t *waiter;           /**< thread owning event queue          */
 } event_queue_t;
 
@@ -263,13 +309,42 @@ void event_post(event_queue_t *queue, event_t *event);
  *
  * This will remove a queued event from an event queue.
  *
- * @note    Due to the underlying list implementation, this will run in O(n).
+ * @note    Due to the underlying list implementation, this will run in O(n),
+ *          or in O(1) with the `event_dlist` module.
+ *
+ * @pre     @p event is either not queued or queued in @p queue
  *
  * @param[in]   queue   event queue to remove event from
  * @param[in]   event   event to remove from queue
  */
 void event_cancel(event_queue_t *queue, event_t *event);
 
+/**
+ * @brief   Check whether an event queue has no pending events
+ *
+ * Covers all priority classes with `event_prio`, so use this instead of
+ * inspecting event_queue_t::event_list.
+ *
+ * @note    Events posted from an ISR or another thread may change the result
+ *          right after the check.
+ *
+ * @param[in]   queue   event queue to check
+ *
+ * @return      true if no event is queued
+ * @return      false otherwise
+ */
+static inline bool event_queue_is_empty(const event_queue_t *queue)
+{
+#if IS_USED(MODULE_EVENT_PRIO)
+    for (unsigned i = 0; i < CONFIG_EVENT_PRIO_NUMOF - 1; i++) {
+        if (queue->prio_lists[i].next) {
+            return false;
+        }
+    }
+#endif
+    return queue->event_list.next == NULL;
+}
+
 /**
  * @brief   Get next event from event queue, non-blocking
  *
@@ -34,6 +34,19 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The implementation of the block compression function is selected at build
+ * time:
+ *
+ * - By default, a compact round loop is used.
+ * - The `hashes_sha2xx_unrolled` module unrolls the rounds. This is faster,
+ *   but needs more ROM.
+ * - The `hashes_sha2xx_x86` module (`native` only) uses the SHA extensions of
+ *   x86 CPUs, or AVX2 for @ref sha256_multi() on CPUs without them. It falls
+ *   back to the portable code at runtime, if the CPU provides neither.
+ *
+ * This also applies to SHA-224.
+ *
  * @{
  *
  * @file
@@ -135,6 +148,23 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void *sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief Computes the hashes of several independent buffers
+ *
+ * With the `hashes_sha2xx_x86` module, the complete blocks all buffers of a
+ * group of eight have in common are hashed in parallel, if the CPU supports
+ * AVX2 but not the faster SHA extensions. Otherwise, this is equivalent to
+ * calling @ref sha256() for every buffer.
+ *
+ * @param[in] data   pointers to the buffers to generate the hashes from
+ * @param[in] len    lengths of the buffers
+ * @param[out] digest pointers to arrays for the results, length of each must
+ *                    be SHA256_DIGEST_LENGTH
+ * @param[in] numof  number of entries in @p data, @p len, and @p digest
+ */
+void sha256_multi(const void *const data[], const size_t len[],
+                  void *const digest[], unsigned numof);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
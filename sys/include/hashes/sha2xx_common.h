@@ -50,9 +50,12 @@
 #ifndef HASHES_SHA2XX_COMMON_H
 #define HASHES_SHA2XX_COMMON_H
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -129,6 +132,65 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief Add the same number of complete blocks into several independent
+ * hashes
+ *
+ * With the `hashes_sha2xx_x86` module, groups of @ref SHA2XX_X86_LANES hashes
+ * are computed in parallel, if the CPU supports AVX2 but not the SHA
+ * extensions. Otherwise, the hashes are computed one after another.
+ *
+ * @pre The bytes added to every context so far are a multiple of 64.
+ *
+ * @param ctx       sha2xx_context_t handles to use
+ * @param[in] data  Input data of each context, `64 * blocks` bytes each
+ * @param[in] blocks Number of 64 byte blocks to add to each context
+ * @param[in] numof Number of entries in @p ctx and @p data
+ */
+void sha2xx_update_multi(sha2xx_context_t *const ctx[],
+                         const void *const data[], size_t blocks,
+                         unsigned numof);
+
+#if IS_USED(MODULE_HASHES_SHA2XX_X86) || defined(DOXYGEN)
+/**
+ * @brief Number of hashes computed in parallel by
+ *        @ref sha2xx_x86_transform_x8()
+ */
+#define SHA2XX_X86_LANES    (8U)
+
+/**
+ * @brief Compresses consecutive blocks using the x86 SHA extensions
+ *
+ * @note Only available with the `hashes_sha2xx_x86` module.
+ *
+ * @param state     State to update
+ * @param[in] data  Blocks to compress
+ * @param[in] blocks Number of 64 byte blocks in @p data
+ *
+ * @return  true, if the blocks were compressed
+ * @return  false, if the CPU does not support the SHA extensions
+ */
+bool sha2xx_x86_transform(uint32_t *state, const void *data, size_t blocks);
+
+/**
+ * @brief Compresses the blocks of @ref SHA2XX_X86_LANES independent hashes in
+ *        parallel using AVX2
+ *
+ * @note Only available with the `hashes_sha2xx_x86` module.
+ *
+ * @param state     States to update
+ * @param[in] data  Blocks to compress for each state
+ * @param[in] blocks Number of 64 byte blocks in each entry of @p data
+ *
+ * @return  true, if the blocks were compressed
+ * @return  false, if the CPU does not support AVX2 or if it supports the SHA
+ *          extensions, so @ref sha2xx_x86_transform() on one state after
+ *          another is faster
+ */
+bool sha2xx_x86_transform_x8(uint32_t *const state[],
+                             const void *const data[], size_t blocks);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
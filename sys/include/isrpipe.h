@@ -11,6 +11,11 @@
  * @ingroup sys
  * @brief ISR -> userspace pipe
  *
+ * The pipe is built on a single-producer, single-consumer lock-free
+ * ringbuffer (see @ref sys_lfring). Only a single context may write to a pipe
+ * (usually one ISR). Several threads may read from the same pipe, e.g. via
+ * `getchar()` on a stdio pipe, so readers are serialized by a mutex.
+ *
  * @{
  * @file
  * @brief       isrpipe Interface
@@ -24,8 +29,8 @@
 
 #include <stdint.h>
 
+#include "lfring.h"
 #include "mutex.h"
-#include "tsrb.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,24 +38,33 @@ extern "C" {
 
 /**
  * @brief   Context structure for isrpipe
+ *
+ * The ringbuffer is lock-free, so there must only be one writer (e.g. the
+ * ISR). Readers take isrpipe_t::read_lock.
  */
 typedef struct {
-    tsrb_t tsrb;        /**< isrpipe thread safe ringbuffer */
+    lfring_t rb;        /**< isrpipe lock-free ringbuffer */
     mutex_t mutex;      /**< isrpipe mutex */
+    mutex_t read_lock;  /**< serializes readers of the ringbuffer */
 } isrpipe_t;
 
 /**
  * @brief   Static initializer for irspipe
+ *
+ * @param[in]   rb_buf      buffer array of a power of two size, at most
+ *                          @ref LFRING_NUMOF_MAX bytes
  */
-#define ISRPIPE_INIT(tsrb_buf) { .mutex = MUTEX_INIT, \
-                                 .tsrb = TSRB_INIT(tsrb_buf) }
+#define ISRPIPE_INIT(rb_buf) { .mutex = MUTEX_INIT, \
+                               .read_lock = MUTEX_INIT, \
+                               .rb = LFRING_INIT(rb_buf, 1) }
 
 /**
  * @brief   Initialisation function for isrpipe
  *
  * @param[in]   isrpipe     isrpipe object to initialize
  * @param[in]   buf         buffer to use as ringbuffer (must be power of two sized!)
- * @param[in]   bufsize     size of @p buf
+ * @param[in]   bufsize     size of @p buf, at most @ref LFRING_NUMOF_MAX
+ *                          (16384) bytes
  */
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize);
 
@@ -68,6 +82,9 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c);
 /**
  * @brief   Read data from isrpipe (blocking)
  *
+ * @warning Must not be called concurrently for the same @p isrpipe, there
+ *          must only be one reading thread.
+ *
  * @param[in]   isrpipe    isrpipe object to operate on
  * @param[in]   buf        buffer to write to
  * @param[in]   count      number of bytes to read
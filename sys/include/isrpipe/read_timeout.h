@@ -32,7 +32,8 @@ extern "C" {
  * @brief   Read data from isrpipe (with timeout, blocking)
  *
  * Currently, the timeout parameter is applied on every underlying read, which
- * might be *per single byte*.
+ * might be *per single byte*. Waiting for another thread reading from
+ * @p isrpipe is limited by the same timeout.
  *
  * @note This function might return less than @p count bytes
  *
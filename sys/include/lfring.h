@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_lfring  Lock-free ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffers of fixed-size elements
+ *
+ * Other than @ref sys_tsrb these ringbuffers do not disable interrupts, so
+ * they are suitable to hand data from interrupt service routines to threads
+ * without adding to the interrupt latency of the system.
+ *
+ * There are two flavors:
+ *
+ * - @ref lfring_t for a single producer and a single consumer, e.g. one
+ *   ISR and one thread. Only atomic loads and stores of the read and write
+ *   positions are required (see @ref sys_atomic_utils).
+ * - @ref lfring_mpsc_t for multiple producers, e.g. several ISRs or
+ *   threads, and a single consumer. The producers reserve their slot with
+ *   an atomic compare-and-swap (C11 atomics, `core/atomic_c11.c` provides
+ *   them for platforms without native support). A producer never waits for
+ *   another one, so it is safe to put elements from an ISR that interrupted
+ *   a producer. The consumer can only take an element once all elements
+ *   reserved before it are complete.
+ *
+ * The number of elements of both must be a power of two and must not exceed
+ * @ref LFRING_NUMOF_MAX.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free ringbuffer definitions
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef LFRING_H
+#define LFRING_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+#include "c11_atomics_compat.hpp"
+#else
+#include <stdatomic.h>
+#endif
+
+#include "atomic_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of elements in a lock-free ringbuffer
+ */
+#define LFRING_NUMOF_MAX    (1U << 14)
+
+/**
+ * @brief   Single-producer, single-consumer lock-free ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;           /**< Buffer of lfring_t::mask + 1 elements */
+    uint16_t elem_size;     /**< Size of an element in bytes */
+    uint16_t mask;          /**< Number of elements - 1 */
+    uint16_t reads;         /**< Total number of reads, consumer only */
+    uint16_t writes;        /**< Total number of writes, producer only */
+} lfring_t;
+
+/**
+ * @brief   Multi-producer, single-consumer lock-free ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;                   /**< Buffer of lfring_mpsc_t::mask + 1
+                                     *   elements */
+    atomic_uint_least16_t *seqs;    /**< Sequence numbers of the elements */
+    atomic_uint_least16_t writes;   /**< Total number of reserved writes */
+    uint16_t reads;                 /**< Total number of reads, consumer
+                                     *   only */
+    uint16_t elem_size;             /**< Size of an element in bytes */
+    uint16_t mask;                  /**< Number of elements - 1 */
+} lfring_mpsc_t;
+
+/**
+ * @brief   Static initializer for @ref lfring_t
+ *
+ * @param[in] BUF       An array of elements. The number of elements must be a
+ *                      power of two.
+ * @param[in] ELEM_SIZE Size of an element in @p BUF.
+ */
+#define LFRING_INIT(BUF, ELEM_SIZE) { (uint8_t *)(BUF), (ELEM_SIZE), \
+                                      (sizeof(BUF) / (ELEM_SIZE)) - 1, 0, 0 }
+
+/**
+ * @brief   Initializes a single-producer, single-consumer ringbuffer
+ *
+ * @param[out] rb       The ringbuffer to initialize.
+ * @param[in] buf       Buffer of @p numof elements of @p elem_size.
+ * @param[in] elem_size Size of an element in bytes.
+ * @param[in] numof     Number of elements in @p buf. Must be a power of two
+ *                      and at most @ref LFRING_NUMOF_MAX.
+ */
+static inline void lfring_init(lfring_t *rb, void *buf, size_t elem_size,
+                               unsigned numof)
+{
+    assert((numof != 0) && ((numof & (numof - 1)) == 0) &&
+           (numof <= LFRING_NUMOF_MAX));
+    assert((elem_size != 0) && (elem_size <= UINT16_MAX));
+
+    rb->buf = buf;
+    rb->elem_size = elem_size;
+    rb->mask = numof - 1;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief   Gets the number of elements available for reading
+ *
+ * @param[in] rb    A ringbuffer.
+ *
+ * @return  Number of elements in @p rb.
+ */
+static inline unsigned lfring_avail(const lfring_t *rb)
+{
+    return (uint16_t)(atomic_load_u16(&rb->writes) -
+                      atomic_load_u16(&rb->reads));
+}
+
+/**
+ * @brief   Checks if a ringbuffer is empty
+ *
+ * @param[in] rb    A ringbuffer.
+ *
+ * @return  1, if @p rb is empty.
+ * @return  0, otherwise.
+ */
+static inline int lfring_empty(const lfring_t *rb)
+{
+    return lfring_avail(rb) == 0;
+}
+
+/**
+ * @brief   Gets the number of elements that can be put into a ringbuffer
+ *
+ * @param[in] rb    A ringbuffer.
+ *
+ * @return  Number of free elements in @p rb.
+ */
+static inline unsigned lfring_free(const lfring_t *rb)
+{
+    return (rb->mask + 1) - lfring_avail(rb);
+}
+
+/**
+ * @brief   Puts an element into a ringbuffer
+ *
+ * @note    Must only be called by the producer.
+ *
+ * @param[in] rb    A ringbuffer.
+ * @param[in] elem  The element. Must be of lfring_t::elem_size bytes.
+ *
+ * @return  0 on success.
+ * @return  -1 if @p rb is full.
+ */
+int lfring_put(lfring_t *rb, const void *elem);
+
+/**
+ * @brief   Puts elements into a ringbuffer
+ *
+ * @note    Must only be called by the producer.
+ *
+ * @param[in] rb    A ringbuffer.
+ * @param[in] elems Array of @p n elements.
+ * @param[in] n     Maximum number of elements to put into @p rb.
+ *
+ * @return  Number of elements put into @p rb.
+ */
+unsigned lfring_put_many(lfring_t *rb, const void *elems, unsigned n);
+
+/**
+ * @brief   Gets an element from a ringbuffer
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in] rb    A ringbuffer.
+ * @param[out] elem The element. Must have space for lfring_t::elem_size
+ *                  bytes.
+ *
+ * @return  0 on success.
+ * @return  -1 if @p rb is empty.
+ */
+int lfring_get(lfring_t *rb, void *elem);
+
+/**
+ * @brief   Gets elements from a ringbuffer
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in] rb        A ringbuffer.
+ * @param[out] elems    Array with space for @p n elements.
+ * @param[in] n         Maximum number of elements to get from @p rb.
+ *
+ * @return  Number of elements written to @p elems.
+ */
+unsigned lfring_get_many(lfring_t *rb, void *elems, unsigned n);
+
+/**
+ * @brief   Initializes a multi-producer, single-consumer ringbuffer
+ *
+ * @param[out] rb       The ringbuffer to initialize.
+ * @param[in] buf       Buffer of @p numof elements of @p elem_size.
+ * @param[in] seqs      Array of @p numof sequence numbers.
+ * @param[in] elem_size Size of an element in bytes.
+ * @param[in] numof     Number of elements in @p buf. Must be a power of two
+ *                      and at most @ref LFRING_NUMOF_MAX.
+ */
+void lfring_mpsc_init(lfring_mpsc_t *rb, void *buf,
+                      atomic_uint_least16_t *seqs, size_t elem_size,
+                      unsigned numof);
+
+/**
+ * @brief   Puts an element into a multi-producer ringbuffer
+ *
+ * @param[in] rb    A ringbuffer.
+ * @param[in] elem  The element. Must be of lfring_mpsc_t::elem_size bytes.
+ *
+ * @return  0 on success.
+ * @return  -1 if @p rb is full.
+ */
+int lfring_mpsc_put(lfring_mpsc_t *rb, const void *elem);
+
+/**
+ * @brief   Gets an element from a multi-producer ringbuffer
+ *
+ * @note    Must only be called by the consumer.
+ *
+ * @param[in] rb    A ringbuffer.
+ * @param[out] elem The element. Must have space for lfring_mpsc_t::elem_size
+ *                  bytes.
+ *
+ * @return  0 on success.
+ * @return  -1 if @p rb is empty or the oldest element is not completely put
+ *          yet.
+ */
+int lfring_mpsc_get(lfring_mpsc_t *rb, void *elem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LFRING_H */
+/** @} */
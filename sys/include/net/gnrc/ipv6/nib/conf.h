@@ -81,6 +81,18 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      1
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_LPM
+#define CONFIG_GNRC_IPV6_NIB_LPM                      1
+#endif
+
+#ifdef MODULE_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  1
+#endif
+
+#ifdef MODULE_GNRC_IPV6_NIB_RC
+#define CONFIG_GNRC_IPV6_NIB_RC                       1
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -193,6 +205,44 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      0
 #endif
 
+/**
+ * @brief   Longest-prefix match trie for off-link entries
+ *
+ * Without this, every route lookup compares the destination against all
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries. With this, the
+ * off-link entries are additionally kept in a path-compressed binary trie, so
+ * the cost of a lookup only depends on the number of nested prefixes. This
+ * pays off for routers with a large forwarding table.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_LPM
+#define CONFIG_GNRC_IPV6_NIB_LPM                      0
+#endif
+
+/**
+ * @brief   Hash index for on-link entries
+ *
+ * Without this, every neighbor cache lookup compares the address against all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF on-link entries. With this, the on-link
+ * entries are additionally kept in a hash table over their IPv6 address, so
+ * lookups stay fast for a large neighbor cache (e.g. on a 6LBR).
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  0
+#endif
+
+/**
+ * @brief   Route cache
+ *
+ * Caches the next hops of the last @ref CONFIG_GNRC_IPV6_NIB_RC_NUMOF
+ * destinations resolved with @ref gnrc_ipv6_nib_get_next_hop_l2addr(), so
+ * consecutive packets to the same destination skip the NIB lookup.
+ *
+ * @see @ref net_gnrc_ipv6_nib_rc
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_RC
+#define CONFIG_GNRC_IPV6_NIB_RC                       0
+#endif
+
 /**
  * @brief   Multihop prefix and 6LoWPAN context distribution
  *
@@ -280,6 +330,28 @@ extern "C" {
 #endif
 #endif
 
+#if CONFIG_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN)
+/**
+ * @brief   Number of buckets of the hash index for on-link entries
+ *
+ * @note    Only used with @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS         (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#endif
+#endif
+
+#if CONFIG_GNRC_IPV6_NIB_RC || defined(DOXYGEN)
+/**
+ * @brief   Number of entries in the route cache
+ *
+ * @note    Only used with @ref CONFIG_GNRC_IPV6_NIB_RC.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_RC_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_RC_NUMOF                (8)
+#endif
+#endif
+
 #endif /* !CONFIG_KCONFIG_MODULE_GNRC_IPV6_NIB || DOXYGEN */
 
 #ifdef __cplusplus
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_nib_rc    Route cache
+ * @ingroup     net_gnrc_ipv6_nib
+ * @brief       Route cache component of neighbor information base
+ *
+ * The route cache remembers the results of
+ * @ref gnrc_ipv6_nib_get_next_hop_l2addr() for the last
+ * @ref CONFIG_GNRC_IPV6_NIB_RC_NUMOF destinations, so consecutive packets to
+ * the same destination don't need to resolve the next hop again. The cache
+ * is flushed whenever the NIB changes.
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_RC.
+ * @{
+ *
+ * @file
+ * @brief   Route cache definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_IPV6_NIB_RC_H
+#define NET_GNRC_IPV6_NIB_RC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Route cache entry view on NIB
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination */
+    gnrc_ipv6_nib_nc_t nce;     /**< neighbor cache view on the next hop to
+                                 *   gnrc_ipv6_nib_rc_t::dst */
+} gnrc_ipv6_nib_rc_t;
+
+/**
+ * @brief   Route cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< lookups answered by the route cache */
+    uint32_t misses;            /**< lookups resolved by the NIB */
+    uint32_t flushes;           /**< number of times the cache was flushed */
+} gnrc_ipv6_nib_rc_stats_t;
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC) || defined(DOXYGEN)
+/**
+ * @brief   Iterates over all valid route cache entries
+ *
+ * @pre `(state != NULL) && (entry != NULL)`
+ *
+ * @param[in,out] state Iteration state of the route cache. Must point to NULL
+ *                      pointer to start iteration
+ * @param[out] entry    The next route cache entry.
+ *
+ * @note    The cache may change during iteration.
+ *
+ * @return  true, if iteration can be continued.
+ * @return  false, if @p entry is the last route cache entry.
+ */
+bool gnrc_ipv6_nib_rc_iter(void **state, gnrc_ipv6_nib_rc_t *entry);
+
+/**
+ * @brief   Prints a route cache entry
+ *
+ * @pre `entry != NULL`
+ *
+ * @param[in] entry A route cache entry
+ */
+void gnrc_ipv6_nib_rc_print(gnrc_ipv6_nib_rc_t *entry);
+
+/**
+ * @brief   Gets the statistics of the route cache
+ *
+ * @pre `stats != NULL`
+ *
+ * @param[out] stats    The statistics of the route cache.
+ */
+void gnrc_ipv6_nib_rc_get_stats(gnrc_ipv6_nib_rc_stats_t *stats);
+
+/**
+ * @brief   Invalidates all route cache entries
+ *
+ * The NIB flushes the cache itself whenever it changes. This is only
+ * required if the result of a next hop resolution changes without the NIB
+ * knowing.
+ */
+void gnrc_ipv6_nib_rc_flush(void);
+#else   /* CONFIG_GNRC_IPV6_NIB_RC || defined(DOXYGEN) */
+#define gnrc_ipv6_nib_rc_iter(state, entry) (false)
+#define gnrc_ipv6_nib_rc_print(entry)       (void)(entry)
+#define gnrc_ipv6_nib_rc_flush()            (void)0
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_IPV6_NIB_RC_H */
+/** @} */
@@ -62,6 +62,33 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Exponent of the smallest data block size class of
+ *          `gnrc_pktbuf_sizeclass`
+ *
+ * @details The smallest block is `2^CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP`
+ *          bytes. A free block needs to hold two pointers, so this must be at
+ *          least 3 on 32-bit platforms.
+ *
+ *          The largest block, and thus the largest single packet snip, is
+ *          the largest power of two not greater than
+ *          @ref CONFIG_GNRC_PKTBUF_SIZE, e.g. 4096 bytes for the default of
+ *          6144 bytes. @ref gnrc_pktbuf_add() and
+ *          @ref gnrc_pktbuf_realloc_data() fail for larger snips.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP    (4U)
+#endif
+
+/**
+ * @brief   Number of packet snip headers in the slab of
+ *          `gnrc_pktbuf_sizeclass`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF \
+    ((CONFIG_GNRC_PKTBUF_SIZE >= 128) ? (CONFIG_GNRC_PKTBUF_SIZE / 128) : 1)
+#endif
 /** @} */
 
 /**
@@ -284,7 +311,10 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_sizeclass` they also include the high-water marks of
+ *          data bytes and snip headers, the free blocks per size class, and
+ *          the external fragmentation of the data pool.
  */
 void gnrc_pktbuf_stats(void);
 #endif
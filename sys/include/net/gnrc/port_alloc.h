@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_port_alloc Ephemeral port allocation
+ * @ingroup     net_gnrc
+ * @brief       Allocation of ephemeral ports for transport layer protocols
+ *
+ * Keeps track of the used ports in the first @ref CONFIG_GNRC_PORT_ALLOC_NUMOF
+ * ports of the dynamic port range in a bitmap. A free port is picked
+ * randomly as specified in
+ * [RFC 6056, section 3.3.2](https://tools.ietf.org/html/rfc6056#section-3.3.2):
+ * on collision a new random port is drawn, so the allocated port never
+ * depends on which ports are already in use.
+ *
+ * The bitmap only knows the ports allocated or reserved through this module.
+ * A port still bound by another endpoint (e.g. with `SOCK_FLAGS_REUSE_EP`
+ * after the reserving socket was closed) or registered directly with
+ * @ref net_gnrc_netreg is caught by the protocol's
+ * @ref gnrc_port_alloc_t::in_use check before a port is handed out.
+ *
+ * Every transport layer protocol has its own port space and thus its own
+ * @ref gnrc_port_alloc_t.
+ * @{
+ *
+ * @file
+ * @brief   Ephemeral port allocation definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_PORT_ALLOC_H
+#define NET_GNRC_PORT_ALLOC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bitfield.h"
+#include "mutex.h"
+#include "net/iana/portrange.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_port_alloc_conf  GNRC ephemeral port allocation compile
+ *                                     configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of ports used for ephemeral port allocation
+ *
+ * Ports are allocated from @ref IANA_DYNAMIC_PORTRANGE_MIN to
+ * `IANA_DYNAMIC_PORTRANGE_MIN + CONFIG_GNRC_PORT_ALLOC_NUMOF - 1`. Every port
+ * takes one bit per protocol. The default covers the complete dynamic port
+ * range, as recommended by RFC 6056, for 2 KiB per protocol. Reduce to save
+ * memory at the cost of a more predictable port choice.
+ *
+ * @note    Must be a multiple of 8 and not greater than 16384.
+ */
+#ifndef CONFIG_GNRC_PORT_ALLOC_NUMOF
+#define CONFIG_GNRC_PORT_ALLOC_NUMOF    (16384U)
+#endif
+/** @} */
+
+/**
+ * @brief   Lowest port number allocated
+ */
+#define GNRC_PORT_ALLOC_MIN             (IANA_DYNAMIC_PORTRANGE_MIN)
+
+/**
+ * @brief   Error value indicating that no free port could be found
+ */
+#define GNRC_PORT_ALLOC_ERR             (0U)
+
+/**
+ * @brief   Checks if a port is bound by the protocol
+ *
+ * @param[in] port  A port.
+ *
+ * @return  true, if @p port is bound.
+ * @return  false, if @p port is free.
+ */
+typedef bool (*gnrc_port_alloc_in_use_t)(uint16_t port);
+
+/**
+ * @brief   Port space of a transport layer protocol
+ */
+typedef struct {
+    mutex_t lock;                                   /**< lock for used */
+    uint16_t numof_used;                            /**< number of used bits */
+    /**
+     * @brief   Protocol-specific check for ports bound without the
+     *          allocator's knowledge, may be NULL
+     */
+    gnrc_port_alloc_in_use_t in_use;
+    BITFIELD(used, CONFIG_GNRC_PORT_ALLOC_NUMOF);   /**< used ports */
+} gnrc_port_alloc_t;
+
+/**
+ * @brief   Static initializer for @ref gnrc_port_alloc_t
+ *
+ * @param[in] check     The protocol's @ref gnrc_port_alloc_in_use_t check
+ */
+#define GNRC_PORT_ALLOC_INIT(check)     { .lock = MUTEX_INIT, \
+                                          .in_use = (check) }
+
+/**
+ * @brief   Allocates a free ephemeral port
+ *
+ * @pre `ports != NULL`
+ *
+ * @param[in,out] ports The port space of the protocol.
+ *
+ * The @ref gnrc_port_alloc_t::in_use check is called with
+ * gnrc_port_alloc_t::lock held, so it must not call into this module.
+ *
+ * @return  The allocated port. Release it with @ref gnrc_port_alloc_release().
+ * @return  @ref GNRC_PORT_ALLOC_ERR, if no free port was found within
+ *          @ref CONFIG_GNRC_PORT_ALLOC_NUMOF random draws.
+ */
+uint16_t gnrc_port_alloc_get(gnrc_port_alloc_t *ports);
+
+/**
+ * @brief   Marks an explicitly chosen port as used
+ *
+ * Prevents @ref gnrc_port_alloc_get() from allocating a port that was chosen
+ * by an application.
+ *
+ * @pre `ports != NULL`
+ *
+ * @param[in,out] ports The port space of the protocol.
+ * @param[in] port      A port.
+ *
+ * @return  true, if @p port was marked as used by this call. It then needs to
+ *          be released with @ref gnrc_port_alloc_release().
+ * @return  false, if @p port is not in the range of ephemeral ports or
+ *          already in use.
+ */
+bool gnrc_port_alloc_reserve(gnrc_port_alloc_t *ports, uint16_t port);
+
+/**
+ * @brief   Releases a port
+ *
+ * @pre `ports != NULL`
+ *
+ * @param[in,out] ports The port space of the protocol.
+ * @param[in] port      A port returned by @ref gnrc_port_alloc_get() or
+ *                      successfully reserved with
+ *                      @ref gnrc_port_alloc_reserve().
+ */
+void gnrc_port_alloc_release(gnrc_port_alloc_t *ports, uint16_t port);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PORT_ALLOC_H */
+/** @} */
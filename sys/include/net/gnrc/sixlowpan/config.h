@@ -153,6 +153,21 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE */
 
+/**
+ * @brief   Number of hash buckets for reassembly buffer and virtual reassembly
+ *          buffer look-ups
+ *
+ * Should be in the order of the number of datagrams expected to be in
+ * reassembly at the same time.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_hash](@ref net_gnrc_sixlowpan_frag_hash)
+ *          module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF      (16U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF */
+
 /**
  * @brief   Timeout for a VRB entry in microseconds
  *
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_hash Hash index for reassembly buffers
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Hash index over (virtual) reassembly buffer entries
+ *
+ * The @ref net_gnrc_sixlowpan_frag_rb "reassembly buffer" and the
+ * @ref net_gnrc_sixlowpan_frag_vrb "virtual reassembly buffer" need to find
+ * the entry of a datagram for every received fragment. Without this module
+ * this is done by comparing all entries of the buffer, so the per-fragment
+ * cost grows linearly with @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE and
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE respectively.
+ *
+ * With the `gnrc_sixlowpan_frag_hash` module, both buffers additionally keep
+ * their entries in @ref CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF buckets, chosen
+ * by the source link-layer address and tag of a datagram, which is the part
+ * of the identifying tuple both buffers have in common. Only the entries in
+ * the datagram's bucket are compared on look-up.
+ *
+ * Entries are (re-)linked when they are assigned to a datagram. Entries that
+ * are removed from a buffer stay in their bucket until they are reused; a
+ * look-up needs to check if the entries it iterates over are still in use.
+ * @{
+ *
+ * @file
+ * @brief   Hash index for reassembly buffer definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_HASH_H
+#define NET_GNRC_SIXLOWPAN_FRAG_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/sixlowpan/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Bucket membership of a single indexed entry
+ */
+typedef struct {
+    uint16_t next;      /**< position + 1 of next entry in the same bucket,
+                         *   0 for end of bucket */
+    uint16_t bucket;    /**< bucket + 1 the entry is linked into, 0 if none */
+} gnrc_sixlowpan_frag_hash_link_t;
+
+/**
+ * @brief   A hash index over an array of (virtual) reassembly buffer entries
+ *
+ * A zeroed index is empty, so indexes in static memory need no
+ * initialization.
+ */
+typedef struct {
+    gnrc_sixlowpan_frag_hash_link_t *links; /**< one link per entry of the
+                                             *   indexed array */
+    uint16_t head[CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF];  /**< position + 1
+                                             *   of first entry per bucket */
+} gnrc_sixlowpan_frag_hash_t;
+
+/**
+ * @brief   Empties an index
+ *
+ * @param[in] hash          The index
+ * @param[in] links_numof   Number of entries in gnrc_sixlowpan_frag_hash_t::links
+ */
+void gnrc_sixlowpan_frag_hash_reset(gnrc_sixlowpan_frag_hash_t *hash,
+                                    unsigned links_numof);
+
+/**
+ * @brief   (Re-)links an entry according to its new datagram identifier
+ *
+ * @param[in] hash      The index
+ * @param[in] pos       Position of the entry in the indexed array
+ * @param[in] src       Source link-layer address of the datagram
+ * @param[in] src_len   Length of @p src
+ * @param[in] tag       Tag of the datagram
+ */
+void gnrc_sixlowpan_frag_hash_set(gnrc_sixlowpan_frag_hash_t *hash,
+                                  unsigned pos, const uint8_t *src,
+                                  size_t src_len, unsigned tag);
+
+/**
+ * @brief   Gets the first entry of the bucket for a datagram identifier
+ *
+ * @param[in] hash      The index
+ * @param[in] src       Source link-layer address of the datagram
+ * @param[in] src_len   Length of @p src
+ * @param[in] tag       Tag of the datagram
+ *
+ * @return  Position of the first entry in the bucket. The entry does not
+ *          necessarily match the identifier.
+ * @return  -1, if the bucket is empty.
+ */
+int gnrc_sixlowpan_frag_hash_first(const gnrc_sixlowpan_frag_hash_t *hash,
+                                   const uint8_t *src, size_t src_len,
+                                   unsigned tag);
+
+/**
+ * @brief   Gets the entry following @p pos in its bucket
+ *
+ * @param[in] hash  The index
+ * @param[in] pos   Position of an entry returned by
+ *                  gnrc_sixlowpan_frag_hash_first() or
+ *                  gnrc_sixlowpan_frag_hash_next()
+ *
+ * @return  Position of the next entry in the bucket.
+ * @return  -1, if @p pos is the last entry of the bucket.
+ */
+static inline int gnrc_sixlowpan_frag_hash_next(
+        const gnrc_sixlowpan_frag_hash_t *hash, int pos)
+{
+    return (int)hash->links[pos].next - 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_HASH_H */
+/** @} */
@@ -163,6 +163,16 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
  *
+ * @note With module `gnrc_tcp_cc`, multiple segments are sent at once and
+ *       this function returns as soon as the data is in the retransmission
+ *       queue, without waiting for the acknowledgment of the peer.
+ *       The amount of data in flight is limited by congestion control as
+ *       specified in RFC 5681. Module `gnrc_tcp_sack` additionally makes use of
+ *       selective acknowledgments (RFC 2018) sent by the peer. SACK is
+ *       supported on the sending side only: GNRC TCP drops out-of-order
+ *       segments, so it has nothing to report in SACK blocks and never
+ *       sends any.
+ *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
@@ -175,6 +185,8 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  * @return   -ECONNRESET if connection was reset by the peer.
  * @return   -ECONNABORTED if the connection was aborted.
  * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ * @return   -ENOMEM if no segment could be allocated in the packet buffer
+ *           (only with module `gnrc_tcp_cc`).
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
@@ -168,6 +168,29 @@ extern "C" {
 #define CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS (60U * MS_PER_SEC)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments in the retransmission queue
+ *
+ * Only used with module `gnrc_tcp_cc`. One entry is reserved for the FIN, so
+ * up to (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1) segments of data can be in
+ * flight. Each entry keeps a full segment in the packet buffer until it is
+ * acknowledged, so the packet buffer must be sized accordingly.
+ *
+ * @note Must be at least 2 and at most 32.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (8U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs triggering a fast retransmit (see RFC 5681)
+ *
+ * Only used with module `gnrc_tcp_cc`.
+ */
+#ifndef CONFIG_GNRC_TCP_DUPACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUPACK_THRESHOLD (3U)
+#endif
+
 /**
  * @brief Message queue size for TCP API internal messaging
  * @note The number of elements in a message queue must be a power of two.
@@ -187,6 +210,11 @@ extern "C" {
 #endif
 /** @} */
 
+#if defined(MODULE_GNRC_TCP_CC) && ((CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE < 2) || \
+                                    (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 32))
+#error "CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE must be between 2 and 32"
+#endif
+
 #ifdef __cplusplus
 }
 #endif
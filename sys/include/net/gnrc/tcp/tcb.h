@@ -70,6 +70,24 @@ typedef struct _transmission_control_block {
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
     gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+#if defined(MODULE_GNRC_TCP_CC) || defined(DOXYGEN)
+    /**
+     * @brief   Unacknowledged packets, oldest first
+     *
+     * @ref gnrc_tcp_tcb_t::pkt_retransmit always points to the first entry
+     */
+    gnrc_pktsnip_t *pkt_queue[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint8_t queue_len;     /**< Number of packets in pkt_queue */
+    uint8_t dupacks;       /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< snd_nxt when the last loss was detected */
+    uint32_t rtt_seq;      /**< Sequence number acknowledging the timed segment */
+#if defined(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+    uint32_t sacked;       /**< Bitmap of packets in pkt_queue selectively
+                                acknowledged by the peer */
+#endif
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
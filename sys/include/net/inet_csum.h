@@ -10,6 +10,12 @@
  * @defgroup    net_inet_csum    Internet Checksum
  * @ingroup     net
  * @brief   Provides a function to calculate the Internet Checksum
+ *
+ * By default, the checksum is calculated byte-wise. With the `inet_csum_word`
+ * module, the buffer is summed up in 32-bit words instead, which is faster
+ * at the cost of some code size. On native, the `inet_csum_x86` module
+ * additionally sums up the words with SSE2 or AVX2, whichever the CPU
+ * provides.
  * @{
  *
  * @file
@@ -23,10 +29,32 @@
 #include <inttypes.h>
 #include <stddef.h>
 
+#include "kernel_defines.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if IS_USED(MODULE_INET_CSUM_X86) || defined(DOXYGEN)
+/**
+ * @brief   Adds up the 32-bit words of @p buf in host byte order with SIMD
+ *          instructions
+ *
+ * Used by inet_csum_slice(). Only sums up the multiple of the vector size
+ * contained in @p buf.
+ *
+ * @note    Only available with the `inet_csum_x86` module.
+ *
+ * @param[in,out] sum   Sum to add the words to.
+ * @param[in] buf       A buffer.
+ * @param[in] len       Length of @p buf in byte.
+ *
+ * @return  Number of bytes at the start of @p buf added to @p sum.
+ * @return  0, if the CPU supports neither SSE2 nor AVX2.
+ */
+size_t inet_csum_x86_sum_words(uint64_t *sum, const void *buf, size_t len);
+#endif
+
 /**
  * @brief   Calculates the unnormalized Internet Checksum of @p buf, where the
  *          buffer provides a slice of the full checksum domain, calculated in order.
@@ -1693,6 +1693,33 @@ extern ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, \
  */
 int coap_match_path(const coap_resource_t *resource, uint8_t *uri);
 
+/**
+ * @brief   Finds the resource for a request in an array of resources
+ *
+ * @p resources must be sorted by path in strcmp() order, with resources for
+ * the same path adjacent. Of all resources whose path matches @p uri
+ * (see coap_match_path()), the first one in @p resources supporting
+ * @p method_flag is returned.
+ *
+ * By default, the resources are searched linearly. With the
+ * `nanocoap_bsearch` module, a binary search is used for every path that is a
+ * prefix of @p uri, so the cost grows logarithmically with the number of
+ * resources instead.
+ *
+ * @param[in]  resources        Array of resources sorted by path
+ * @param[in]  resources_numof  Number of entries in @p resources
+ * @param[in]  uri              Null-terminated URI path of the request
+ * @param[in]  method_flag      Method of the request as @ref coap_method_flags_t
+ * @param[out] resource         The matching resource
+ *
+ * @return  0 if a matching resource was found
+ * @return  -ENOENT if no resource matches @p uri
+ * @return  -ENOTSUP if resources match @p uri, but not @p method_flag
+ */
+int coap_find_resource(const coap_resource_t *resources, size_t resources_numof,
+                       const uint8_t *uri, coap_method_flags_t method_flag,
+                       const coap_resource_t **resource);
+
 #if defined(MODULE_GCOAP) || defined(DOXYGEN)
 /**
  * @name    Functions -- gcoap specific
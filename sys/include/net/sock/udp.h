@@ -344,6 +344,33 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram to send or receive with @ref sock_udp_send_many() or
+ *          @ref sock_udp_recv_many()
+ */
+typedef struct {
+    /**
+     * @brief   Payload of the datagram
+     *
+     * Buffer for the received payload with @ref sock_udp_recv_many().
+     */
+    void *data;
+    /**
+     * @brief   Length of sock_udp_mmsg_t::data
+     *
+     * Space available at sock_udp_mmsg_t::data when passed to
+     * @ref sock_udp_recv_many(), set to the number of bytes received by it.
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * May be `NULL`. See the `remote` parameter of @ref sock_udp_send() and
+     * @ref sock_udp_recv() respectively.
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_mmsg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -596,6 +623,45 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Waits like @ref sock_udp_recv() for the first datagram, then takes all
+ * further datagrams already queued for @p sock, up to @p msgs_numof, without
+ * blocking again. This saves a wake-up of the calling thread per datagram
+ * when datagrams arrive in bursts.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (msgs_numof > 0)`
+ * @pre sock_udp_mmsg_t::data of all @p msgs is not `NULL` and
+ *      `sock_udp_mmsg_t::len > 0`
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in,out] msgs      Buffers for the received datagrams. On return,
+ *                          sock_udp_mmsg_t::len of the first messages holds
+ *                          the number of bytes received.
+ * @param[in] msgs_numof    Number of messages in @p msgs.
+ * @param[in] timeout       Timeout for the first datagram in microseconds.
+ *                          If 0 and no data is available, the function
+ *                          returns immediately.
+ *                          May be @ref SOCK_NO_TIMEOUT for no timeout (wait
+ *                          until data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Function blocks if no packet is currently waiting.
+ * @note    Datagrams from other remotes than the remote end point of @p sock
+ *          are dropped silently after the first datagram was received. On any
+ *          other error after the first datagram, the datagrams received so far
+ *          are returned and the datagram causing the error is dropped.
+ *
+ * @return  The number of datagrams received in @p msgs on success.
+ * @return  Same errors as @ref sock_udp_recv(), if no datagram was received.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                       unsigned msgs_numof, uint32_t timeout);
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
@@ -674,6 +740,33 @@ static inline ssize_t sock_udp_send(sock_udp_t *sock,
     return sock_udp_send_aux(sock, data, len, remote, NULL);
 }
 
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * Sends the datagrams in @p msgs in order, as @ref sock_udp_send() would for
+ * each of them, and stops at the first datagram that could not be sent.
+ *
+ * @pre `(msgs != NULL) && (msgs_numof > 0)`
+ * @pre sock_udp_mmsg_t::remote of all @p msgs may only be `NULL`, if @p sock
+ *      has a remote end point
+ *
+ * @param[in] sock          A UDP sock object. May be `NULL`, see
+ *                          @ref sock_udp_send().
+ * @param[in] msgs          The datagrams to send.
+ * @param[in] msgs_numof    Number of messages in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of datagrams sent on success. If smaller than
+ *          @p msgs_numof, sending the next datagram failed.
+ * @return  Same errors as @ref sock_udp_send(), if the first datagram could
+ *          not be sent.
+ */
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_mmsg_t *msgs,
+                       unsigned msgs_numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
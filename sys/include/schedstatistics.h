@@ -50,6 +50,14 @@ typedef struct {
  */
 extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+/**
+ *  @brief  Callback updating the statistics on a context switch
+ *
+ *  @param[in] active_thread    PID of the thread that was running
+ *  @param[in] next_thread      PID of the thread to run next
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 /**
  *  @brief  Registers the sched statistics callback and sets laststart for
  *          caller thread
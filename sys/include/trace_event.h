@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_trace_event Binary event trace
+ * @ingroup     sys
+ * @brief       Low-overhead, always-on trace of system events
+ *
+ * Other than @ref trace.h, which records arbitrary values of the application,
+ * this module records typed events of the system into a ring buffer of
+ * @ref CONFIG_TRACE_EVENT_NUMOF binary records:
+ *
+ * | Event                         | Recorded by           | arg0       | arg1        |
+ * |:----------------------------- |:--------------------- |:---------- |:----------- |
+ * | @ref TRACE_EVENT_SCHED        | `sched_run()`         | next PID   | -           |
+ * | @ref TRACE_EVENT_MSG_SEND     | `msg_send()` & co.    | target PID | `msg_t::type` |
+ * | @ref TRACE_EVENT_MSG_RECV     | `msg_receive()` & co. | sender PID | `msg_t::type` |
+ * | @ref TRACE_EVENT_ISR_ENTER    | `native` ISR dispatch | signal     | -           |
+ * | @ref TRACE_EVENT_ISR_EXIT     | `native` ISR dispatch | signal     | -           |
+ * | @ref TRACE_EVENT_PKTBUF_ALLOC | @ref net_gnrc_pktbuf  | size       | snip        |
+ * | @ref TRACE_EVENT_PKTBUF_FREE  | @ref net_gnrc_pktbuf  | size       | snip        |
+ * | @ref TRACE_EVENT_NETIF_SEND   | @ref net_gnrc_netif   | netif PID  | packet      |
+ * | @ref TRACE_EVENT_NETIF_RECV   | @ref net_gnrc_netif   | netif PID  | packet      |
+ *
+ * Both arguments are recorded with 32 bits, so sizes and pointers are not
+ * truncated. Each record also contains the time in microseconds and the PID
+ * of the thread the event happened in (or @ref TRACE_EVENT_PID_ISR). Recording an
+ * event takes a slot of the ring buffer with an atomic increment, so it does
+ * not disable interrupts and is safe from anywhere. When the ring buffer is
+ * full, the oldest events are overwritten.
+ *
+ * Event types can be excluded at compile time with
+ * @ref CONFIG_TRACE_EVENT_MASK, which removes their instrumentation
+ * completely. Without the `trace_event` module, no instrumentation is
+ * compiled in at all.
+ *
+ * With the `shell_commands` module, the shell command `trace_event` dumps the
+ * ring buffer. `dist/tools/trace_event/trace_event2json.py` converts the dump
+ * into the Chrome trace event format, which can be opened with
+ * `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Binary event trace definitions
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef TRACE_EVENT_H
+#define TRACE_EVENT_H
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_trace_event_conf Binary event trace compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of events in the ring buffer
+ *
+ * @note    Must be a power of two.
+ */
+#ifndef CONFIG_TRACE_EVENT_NUMOF
+#define CONFIG_TRACE_EVENT_NUMOF    (256U)
+#endif
+
+/**
+ * @brief   Event types to record
+ *
+ * Bit `n` enables the event type with the value `n` of
+ * @ref trace_event_type_t.
+ */
+#ifndef CONFIG_TRACE_EVENT_MASK
+#define CONFIG_TRACE_EVENT_MASK     (0xffffffffUL)
+#endif
+/** @} */
+
+/**
+ * @brief   PID recorded for events that happened in interrupt context
+ */
+#define TRACE_EVENT_PID_ISR         (-1)
+
+/**
+ * @brief   Event types
+ *
+ * @note    The values are part of the binary format of the dump, so new
+ *          types must only be appended.
+ */
+typedef enum {
+    TRACE_EVENT_SCHED = 0,          /**< context switch */
+    TRACE_EVENT_MSG_SEND,           /**< message sent */
+    TRACE_EVENT_MSG_RECV,           /**< message received */
+    TRACE_EVENT_ISR_ENTER,          /**< interrupt service routine entered */
+    TRACE_EVENT_ISR_EXIT,           /**< interrupt service routine left */
+    TRACE_EVENT_PKTBUF_ALLOC,       /**< packet snip allocated */
+    TRACE_EVENT_PKTBUF_FREE,        /**< packet snip released */
+    TRACE_EVENT_NETIF_SEND,         /**< packet handed to network device */
+    TRACE_EVENT_NETIF_RECV,         /**< packet received from network device */
+    TRACE_EVENT_USER,               /**< event of the application */
+} trace_event_type_t;
+
+/**
+ * @brief   A recorded event
+ *
+ * The dump contains the records in their memory representation.
+ */
+typedef struct {
+    uint32_t time;      /**< time of the event in microseconds */
+    uint8_t type;       /**< type of the event (see @ref trace_event_type_t) */
+    int8_t pid;         /**< thread the event happened in */
+    uint16_t reserved;  /**< always 0 */
+    uint32_t arg0;      /**< first argument of the event */
+    uint32_t arg1;      /**< second argument of the event */
+} trace_event_t;
+
+/**
+ * @brief   Records an event, if its type is enabled
+ *
+ * @param[in] type  Type of the event (see @ref trace_event_type_t).
+ * @param[in] arg0  First argument of the event.
+ * @param[in] arg1  Second argument of the event.
+ */
+#define TRACE_EVENT(type, arg0, arg1)                                   \
+    do {                                                                \
+        if (IS_USED(MODULE_TRACE_EVENT) &&                              \
+            (CONFIG_TRACE_EVENT_MASK & (1UL << (type)))) {              \
+            trace_event_add((type), (uint32_t)(arg0), (uint32_t)(arg1));\
+        }                                                               \
+    } while (0)
+
+/**
+ * @brief   Starts recording the events of the scheduler
+ *
+ * @note    Called by auto_init.
+ */
+void trace_event_init(void);
+
+/**
+ * @brief   Records an event
+ *
+ * Use @ref TRACE_EVENT() instead, so disabled event types are compiled out.
+ *
+ * @param[in] type  Type of the event.
+ * @param[in] arg0  First argument of the event.
+ * @param[in] arg1  Second argument of the event.
+ */
+void trace_event_add(trace_event_type_t type, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief   Prints the ring buffer
+ *
+ * The output is framed by `trace_event begin` and `trace_event end` lines and
+ * contains the names of all threads and every event, oldest first, as
+ * hexadecimal dump of its @ref trace_event_t. No events are recorded while
+ * dumping.
+ */
+void trace_event_dump(void);
+
+/**
+ * @brief   Empties the ring buffer
+ */
+void trace_event_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_EVENT_H */
+/** @} */
@@ -135,10 +135,20 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For clocks carrying many concurrent timers, the `ztimer_heap` module
+ * replaces the list with a pairing heap:
+ *
+ * - three pointers per timer object (sibling, child, parent/left sibling)
+ *   and a tag marking it as set, so timers need no initialization
+ * - entries store their absolute target, compared relative to B; timers
+ *   expiring while B advances are moved to a short FIFO of expired timers
+ * - constant get_min() and O(1) insertion
+ * - O(log n) amortized removal of timer objects
+ * - timers with equal target do not necessarily fire in the order they were
+ *   set
+ *
+ * tests/bench_ztimer_set compares the time spent with interrupts disabled in
+ * ztimer_set() / ztimer_remove() for both implementations.
  *
  *
  * ## Clock extension
@@ -263,6 +273,17 @@ typedef struct ztimer_clock ztimer_clock_t;
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    /* With ztimer_heap, next is the right sibling in the timer heap and
+     * offset the absolute target of the timer */
+    ztimer_base_t *child;       /**< first child in timer heap (ztimer_heap) */
+    ztimer_base_t *prev;        /**< left sibling or parent in timer heap
+                                     (ztimer_heap) */
+    uintptr_t armed;            /**< tag derived from the timer's and the
+                                     clock's address while the timer is set,
+                                     so uninitialized timers never count as
+                                     set (ztimer_heap) */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -314,6 +335,10 @@ struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *expired;         /**< expired timers not yet handled,
+                                         last is their tail (ztimer_heap) */
+#endif
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -17,17 +17,23 @@
  * @}
  */
 
+#include <assert.h>
+
 #include "isrpipe.h"
 
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize)
 {
+    /* the lock-free ringbuffer indexes at most LFRING_NUMOF_MAX bytes */
+    assert(bufsize <= LFRING_NUMOF_MAX);
+
     mutex_init(&isrpipe->mutex);
-    tsrb_init(&isrpipe->tsrb, buf, bufsize);
+    mutex_init(&isrpipe->read_lock);
+    lfring_init(&isrpipe->rb, buf, 1, bufsize);
 }
 
 int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
 {
-    int res = tsrb_add_one(&isrpipe->tsrb, c);
+    int res = lfring_put(&isrpipe->rb, &c);
 
     /* `res` is either 0 on success or -1 when the buffer is full. Either way,
      * unlocking the mutex is fine.
@@ -41,8 +47,11 @@ int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
 {
     int res;
 
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    /* the ringbuffer supports a single consumer only */
+    mutex_lock(&isrpipe->read_lock);
+    while (!(res = lfring_get_many(&isrpipe->rb, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
     }
+    mutex_unlock(&isrpipe->read_lock);
     return res;
 }
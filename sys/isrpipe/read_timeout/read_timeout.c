@@ -43,8 +43,12 @@ int isrpipe_read_timeout(isrpipe_t *isrpipe, uint8_t *buffer, size_t count, uint
 
     xtimer_t timer = { .callback = _cb, .arg = &_timeout };
 
+    /* the ringbuffer supports a single consumer only */
+    if (xtimer_mutex_lock_timeout(&isrpipe->read_lock, timeout) < 0) {
+        return -ETIMEDOUT;
+    }
     xtimer_set(&timer, timeout);
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    while (!(res = lfring_get_many(&isrpipe->rb, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
         if (_timeout.flag) {
             res = -ETIMEDOUT;
@@ -53,6 +57,7 @@ int isrpipe_read_timeout(isrpipe_t *isrpipe, uint8_t *buffer, size_t count, uint
     }
 
     xtimer_remove(&timer);
+    mutex_unlock(&isrpipe->read_lock);
     return res;
 }
 
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_lfring
+ * @{
+ *
+ * @file
+ * @brief       Lock-free ringbuffer implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "lfring.h"
+
+static inline uint8_t *_elem(uint8_t *buf, uint16_t mask, uint16_t elem_size,
+                             uint16_t pos)
+{
+    return &buf[(pos & mask) * elem_size];
+}
+
+/* number of elements from pos to the end of the buffer, as copies of more
+ * elements need to wrap around */
+static inline unsigned _until_end(const lfring_t *rb, uint16_t pos,
+                                  unsigned n)
+{
+    unsigned until_end = (rb->mask + 1) - (pos & rb->mask);
+
+    return (until_end < n) ? until_end : n;
+}
+
+static void _copy_in(lfring_t *rb, uint16_t pos, const uint8_t *elems,
+                     unsigned n)
+{
+    size_t len = _until_end(rb, pos, n) * rb->elem_size;
+
+    memcpy(_elem(rb->buf, rb->mask, rb->elem_size, pos), elems, len);
+    memcpy(rb->buf, &elems[len], (n * rb->elem_size) - len);
+}
+
+static void _copy_out(const lfring_t *rb, uint16_t pos, uint8_t *elems,
+                      unsigned n)
+{
+    size_t len = _until_end(rb, pos, n) * rb->elem_size;
+
+    memcpy(elems, _elem(rb->buf, rb->mask, rb->elem_size, pos), len);
+    memcpy(&elems[len], rb->buf, (n * rb->elem_size) - len);
+}
+
+int lfring_put(lfring_t *rb, const void *elem)
+{
+    /* only the producer writes rb->writes, so no atomic access required */
+    uint16_t writes = rb->writes;
+
+    if ((uint16_t)(writes - atomic_load_u16(&rb->reads)) > rb->mask) {
+        return -1;
+    }
+    memcpy(_elem(rb->buf, rb->mask, rb->elem_size, writes), elem,
+           rb->elem_size);
+    /* publish element only after it was copied */
+    atomic_store_u16(&rb->writes, writes + 1);
+    return 0;
+}
+
+unsigned lfring_put_many(lfring_t *rb, const void *elems, unsigned n)
+{
+    uint16_t writes = rb->writes;
+    unsigned free = (rb->mask + 1) -
+                    (uint16_t)(writes - atomic_load_u16(&rb->reads));
+
+    if (n > free) {
+        n = free;
+    }
+    _copy_in(rb, writes, elems, n);
+    atomic_store_u16(&rb->writes, writes + n);
+    return n;
+}
+
+int lfring_get(lfring_t *rb, void *elem)
+{
+    /* only the consumer writes rb->reads, so no atomic access required */
+    uint16_t reads = rb->reads;
+
+    if (atomic_load_u16(&rb->writes) == reads) {
+        return -1;
+    }
+    memcpy(elem, _elem(rb->buf, rb->mask, rb->elem_size, reads),
+           rb->elem_size);
+    /* release element only after it was copied */
+    atomic_store_u16(&rb->reads, reads + 1);
+    return 0;
+}
+
+unsigned lfring_get_many(lfring_t *rb, void *elems, unsigned n)
+{
+    uint16_t reads = rb->reads;
+    unsigned avail = (uint16_t)(atomic_load_u16(&rb->writes) - reads);
+
+    if (n > avail) {
+        n = avail;
+    }
+    _copy_out(rb, reads, elems, n);
+    atomic_store_u16(&rb->reads, reads + n);
+    return n;
+}
+
+void lfring_mpsc_init(lfring_mpsc_t *rb, void *buf,
+                      atomic_uint_least16_t *seqs, size_t elem_size,
+                      unsigned numof)
+{
+    assert((numof != 0) && ((numof & (numof - 1)) == 0) &&
+           (numof <= LFRING_NUMOF_MAX));
+    assert((elem_size != 0) && (elem_size <= UINT16_MAX));
+
+    rb->buf = buf;
+    rb->seqs = seqs;
+    rb->elem_size = elem_size;
+    rb->mask = numof - 1;
+    rb->reads = 0;
+    /* slot i is free for the write with position i */
+    for (unsigned i = 0; i < numof; i++) {
+        atomic_init(&seqs[i], i);
+    }
+    atomic_init(&rb->writes, 0);
+}
+
+/*
+ * Every slot carries a sequence number:
+ *
+ * - `pos`: free for the write at position `pos`
+ * - `pos + 1`: holds the element written at position `pos`
+ *
+ * After the element was read, the sequence number becomes `pos + numof`,
+ * i.e. the slot is free for the write of the next round.
+ */
+int lfring_mpsc_put(lfring_mpsc_t *rb, const void *elem)
+{
+    uint_least16_t pos = atomic_load_explicit(&rb->writes,
+                                              memory_order_relaxed);
+    atomic_uint_least16_t *seq;
+
+    while (1) {
+        int16_t diff;
+
+        seq = &rb->seqs[pos & rb->mask];
+        diff = (int16_t)(uint16_t)(atomic_load_explicit(seq,
+                                                        memory_order_acquire) -
+                                   pos);
+        if (diff == 0) {
+            /* slot is free, try to reserve it */
+            if (atomic_compare_exchange_weak_explicit(&rb->writes, &pos,
+                                                      (uint16_t)(pos + 1),
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+            /* pos was updated by the failed exchange */
+        }
+        else if (diff < 0) {
+            /* slot was not read yet in the last round */
+            return -1;
+        }
+        else {
+            /* another producer reserved the slot */
+            pos = atomic_load_explicit(&rb->writes, memory_order_relaxed);
+        }
+    }
+    memcpy(_elem(rb->buf, rb->mask, rb->elem_size, pos), elem,
+           rb->elem_size);
+    atomic_store_explicit(seq, (uint16_t)(pos + 1), memory_order_release);
+    return 0;
+}
+
+int lfring_mpsc_get(lfring_mpsc_t *rb, void *elem)
+{
+    uint16_t pos = rb->reads;
+    atomic_uint_least16_t *seq = &rb->seqs[pos & rb->mask];
+
+    if ((uint16_t)atomic_load_explicit(seq, memory_order_acquire) !=
+        (uint16_t)(pos + 1)) {
+        /* empty or the producer did not finish yet */
+        return -1;
+    }
+    memcpy(elem, _elem(rb->buf, rb->mask, rb->elem_size, pos),
+           rb->elem_size);
+    atomic_store_explicit(seq, (uint16_t)(pos + rb->mask + 1),
+                          memory_order_release);
+    rb->reads = pos + 1;
+    return 0;
+}
@@ -455,7 +455,6 @@ static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_pkt_t *pdu)
 {
     uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
-    int ret = GCOAP_RESOURCE_NO_PATH;
 
     if (coap_get_uri_path(pdu, uri) <= 0) {
         /* The Uri-Path options are longer than
@@ -467,34 +466,15 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     coap_method_flags_t method_flag = coap_method2flag(
         coap_get_code_detail(pdu));
 
-    for (size_t i = 0; i < listener->resources_len; i++) {
-        *resource = &listener->resources[i];
-
-        int res = coap_match_path(*resource, uri);
-
-        /* URI mismatch */
-        if (res > 0) {
-            continue;
-        }
-        /* resources expected in alphabetical order */
-        else if (res < 0) {
-            break;
-        }
-
-        /* potential match, check for method */
-        if (! ((*resource)->methods & method_flag)) {
-            /* record wrong method error for next iteration, in case
-             * another resource with the same URI and correct method
-             * exists */
-            ret = GCOAP_RESOURCE_WRONG_METHOD;
-            continue;
-        }
-        else {
+    switch (coap_find_resource(listener->resources, listener->resources_len,
+                               uri, method_flag, resource)) {
+        case 0:
             return GCOAP_RESOURCE_FOUND;
-        }
+        case -ENOTSUP:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        default:
+            return GCOAP_RESOURCE_NO_PATH;
     }
-
-    return ret;
 }
 
 /*
@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "kernel_defines.h"
 #include "net/nanocoap.h"
 
 #define ENABLE_DEBUG 0
@@ -176,6 +177,116 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
     return res;
 }
 
+#if IS_USED(MODULE_NANOCOAP_BSEARCH)
+/* compares a resource path to the first len characters of uri */
+static int _path_cmp(const char *path, const char *uri, size_t len)
+{
+    int res = strncmp(path, uri, len);
+
+    if ((res == 0) && (path[len] != '\0')) {
+        res = 1;
+    }
+    return res;
+}
+
+/* index of the first resource in [0, numof) sorting after uri[0:len] */
+static size_t _upper_bound(const coap_resource_t *resources, size_t numof,
+                           const char *uri, size_t len)
+{
+    size_t lo = 0;
+
+    while (lo < numof) {
+        size_t mid = lo + (numof - lo) / 2;
+
+        if (_path_cmp(resources[mid].path, uri, len) <= 0) {
+            lo = mid + 1;
+        }
+        else {
+            numof = mid;
+        }
+    }
+    return lo;
+}
+
+int coap_find_resource(const coap_resource_t *resources, size_t resources_numof,
+                       const uint8_t *uri, coap_method_flags_t method_flag,
+                       const coap_resource_t **resource)
+{
+    const char *uri_str = (const char *)uri;
+    const size_t uri_len = strlen(uri_str);
+    size_t len = uri_len;
+    size_t hi = resources_numof;
+    int res = -ENOENT;
+
+    /* Visits all resource paths that are a prefix of the URI, from the
+     * longest to the shortest. A path that is a prefix of uri[0:len] is the
+     * last one sorting before or equal to it, all resources in between share
+     * its prefix. So if the last resource is no prefix, the next candidate
+     * must be a prefix of what it has in common with the URI. */
+    while ((hi = _upper_bound(resources, hi, uri_str, len)) > 0) {
+        const char *path = resources[hi - 1].path;
+        size_t common = 0;
+
+        while ((common < len) && (path[common] == uri_str[common])) {
+            common++;
+        }
+        if (path[common] != '\0') {
+            len = common;
+            continue;
+        }
+        /* resources with the same path are adjacent, the first one with a
+         * matching method wins, as with the linear search */
+        while ((hi > 0) && (strcmp(resources[hi - 1].path, path) == 0)) {
+            const coap_resource_t *r = &resources[--hi];
+
+            if ((common == uri_len) || (r->methods & COAP_MATCH_SUBTREE)) {
+                if (r->methods & method_flag) {
+                    *resource = r;
+                    res = 0;
+                }
+                else if (res != 0) {
+                    res = -ENOTSUP;
+                }
+            }
+        }
+        if (common == 0) {
+            break;
+        }
+        len = common - 1;
+    }
+    return res;
+}
+#else   /* IS_USED(MODULE_NANOCOAP_BSEARCH) */
+int coap_find_resource(const coap_resource_t *resources, size_t resources_numof,
+                       const uint8_t *uri, coap_method_flags_t method_flag,
+                       const coap_resource_t **resource)
+{
+    int res = -ENOENT;
+
+    for (size_t i = 0; i < resources_numof; i++) {
+        int cmp = coap_match_path(&resources[i], (uint8_t *)uri);
+
+        /* URI mismatch */
+        if (cmp > 0) {
+            continue;
+        }
+        /* resources expected in alphabetical order */
+        else if (cmp < 0) {
+            break;
+        }
+
+        if (resources[i].methods & method_flag) {
+            *resource = &resources[i];
+            return 0;
+        }
+        /* record wrong method, in case another resource with the same URI
+         * and the correct method exists */
+        res = -ENOTSUP;
+    }
+    return res;
+}
+#endif  /* IS_USED(MODULE_NANOCOAP_BSEARCH) */
+
 uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
 {
     const coap_optpos_t *optpos = pkt->options;
@@ -419,22 +530,10 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
-    for (unsigned i = 0; i < resources_numof; i++) {
-        const coap_resource_t *resource = &resources[i];
-        if (!(resource->methods & method_flag)) {
-            continue;
-        }
-
-        int res = coap_match_path(resource, uri);
-        if (res > 0) {
-            continue;
-        }
-        else if (res < 0) {
-            break;
-        }
-        else {
-            return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
-        }
+    const coap_resource_t *resource;
+    if (coap_find_resource(resources, resources_numof, uri, method_flag,
+                           &resource) == 0) {
+        return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
     }
 
     return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
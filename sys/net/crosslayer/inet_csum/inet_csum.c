@@ -13,13 +13,80 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include "byteorder.h"
+#include "kernel_defines.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_INET_CSUM_WORD)
+/* views on the buffer in words, may_alias permits them to access data of any
+ * type */
+typedef uint16_t __attribute__((__may_alias__)) _alias_u16_t;
+typedef uint32_t __attribute__((__may_alias__)) _alias_u32_t;
+
+/* Sums up buf in 16-bit words in network byte order, with an odd last byte
+ * as the upper half of its word. As the Internet Checksum is independent of
+ * the byte order, buf is summed up in aligned 32-bit words in host byte order
+ * instead and the result is swapped if required (see RFC 1071, 2.(B)) */
+static uint16_t _sum_words(const uint8_t *buf, size_t len)
+{
+    /* a buffer at an odd address is summed up shifted by one byte */
+    const bool odd = ((uintptr_t)buf & 1);
+    uint64_t sum = 0;
+    uint16_t half = 0;
+
+    if (odd && (len > 0)) {
+        ((uint8_t *)&half)[1] = *buf;
+        sum += half;
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += *((const _alias_u16_t *)(uintptr_t)buf);
+        buf += 2;
+        len -= 2;
+    }
+    const _alias_u32_t *words = (const _alias_u32_t *)(uintptr_t)buf;
+#if IS_USED(MODULE_INET_CSUM_X86)
+    size_t done = inet_csum_x86_sum_words(&sum, words, len);
+
+    words += done / 4;
+    len -= done;
+#endif
+    for (; len >= 16; words += 4, len -= 16) {
+        sum += (uint64_t)words[0] + words[1] + words[2] + words[3];
+    }
+    for (; len >= 4; words++, len -= 4) {
+        sum += *words;
+    }
+    buf = (const uint8_t *)words;
+    if (len >= 2) {
+        sum += *((const _alias_u16_t *)(uintptr_t)buf);
+        buf += 2;
+        len -= 2;
+    }
+    if (len > 0) {
+        half = 0;
+        ((uint8_t *)&half)[0] = *buf;
+        sum += half;
+    }
+
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    /* the sum is in host byte order, swapped once more when shifted */
+    if (odd != (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) {
+        return byteorder_swaps(sum);
+    }
+    return sum;
+}
+#endif
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -45,6 +112,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
+#if IS_USED(MODULE_INET_CSUM_WORD)
+    csum += _sum_words(buf, len);
+#else
     for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
         csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
                                                     /* and add them */
@@ -52,6 +122,7 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+#endif
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
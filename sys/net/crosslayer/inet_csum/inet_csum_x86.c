@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_inet_csum
+ * @{
+ *
+ * @file
+ * @brief       Internet Checksum word sums using SSE2 and AVX2
+ *
+ * The 32-bit words are zero-extended into 64-bit lanes, so the sum can't
+ * overflow for any buffer length inet_csum_slice() accepts. The functions
+ * are compiled for their instruction set extension only, the CPU is checked
+ * once at runtime.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_INET_CSUM_X86) && \
+    (defined(__i386__) || defined(__x86_64__))
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/inet_csum.h"
+
+#define CPU_SSE2        (1U << 0)
+#define CPU_AVX2        (1U << 1)
+#define CPU_CHECKED     (1U << 2)
+
+static unsigned _cpu;
+
+static unsigned _cpu_features(void)
+{
+    unsigned eax, ebx, ecx, edx;
+    unsigned features = CPU_CHECKED;
+
+    /* the result is always the same, so concurrent checks do no harm */
+    if (_cpu) {
+        return _cpu;
+    }
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return (_cpu = features);
+    }
+    if (edx & bit_SSE2) {
+        features |= CPU_SSE2;
+    }
+    /* the OS must save the AVX registers on context switch */
+    bool avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX);
+
+    if (avx) {
+        unsigned xcr0_lo, xcr0_hi;
+
+        __asm__ volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+        (void)xcr0_hi;
+        avx = ((xcr0_lo & 0x6) == 0x6);
+    }
+    if (avx && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+        (ebx & bit_AVX2)) {
+        features |= CPU_AVX2;
+    }
+    return (_cpu = features);
+}
+
+__attribute__((target("sse2")))
+static uint64_t _sum_sse2(const uint8_t *buf, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint64_t lanes[2];
+
+    for (; len >= 16; buf += 16, len -= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(uintptr_t)buf);
+
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, zero));
+    }
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1];
+}
+
+__attribute__((target("avx2")))
+static uint64_t _sum_avx2(const uint8_t *buf, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = zero;
+    uint64_t lanes[4];
+
+    /* the unpacks work on each 128-bit half, which doesn't matter for a sum */
+    for (; len >= 32; buf += 32, len -= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(uintptr_t)buf);
+
+        acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(v, zero));
+        acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(v, zero));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+size_t inet_csum_x86_sum_words(uint64_t *sum, const void *buf, size_t len)
+{
+    unsigned features = _cpu_features();
+
+    if (features & CPU_AVX2) {
+        len &= ~(size_t)31;
+        *sum += _sum_avx2(buf, len);
+    }
+    else if (features & CPU_SSE2) {
+        len &= ~(size_t)15;
+        *sum += _sum_sse2(buf, len);
+    }
+    else {
+        len = 0;
+    }
+    return len;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif
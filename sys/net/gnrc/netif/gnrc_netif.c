@@ -41,6 +41,7 @@
 #include "fmt.h"
 #include "log.h"
 #include "sched.h"
+#include "trace_event.h"
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
 #include "xtimer.h"
 #endif
@@ -1529,6 +1530,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
      * layer implementations in case `gnrc_netif_pktq` is included */
     gnrc_pktbuf_hold(pkt, 1);
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+    TRACE_EVENT(TRACE_EVENT_NETIF_SEND, netif->pid, (uintptr_t)pkt);
     res = netif->ops->send(netif, pkt);
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     if (res == -EBUSY) {
@@ -1745,6 +1747,8 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+                    TRACE_EVENT(TRACE_EVENT_NETIF_RECV, netif->pid,
+                                (uintptr_t)pkt);
                     _pass_on_packet(pkt);
                 }
                 break;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ *
+ */
+
+/**
+ * @ingroup sys_auto_init_gnrc_netif
+ * @{
+ *
+ * @file
+ * @brief   Auto initialization for @ref drivers_shm_radio devices
+ *
+ * @author  agent <agent@local>
+ */
+
+#include "log.h"
+#include "shm_radio.h"
+#include "shm_radio_params.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "include/init_devs.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Define stack parameters for the MAC layer thread
+ */
+#define SHM_RADIO_MAC_STACKSIZE     (IEEE802154_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE)
+#ifndef SHM_RADIO_MAC_PRIO
+#define SHM_RADIO_MAC_PRIO          (GNRC_NETIF_PRIO)
+#endif
+
+/**
+ * @brief   Stacks for the MAC layer threads
+ */
+static char _shm_radio_stacks[SHM_RADIO_MAX][SHM_RADIO_MAC_STACKSIZE];
+static shm_radio_t _shm_radios[SHM_RADIO_MAX];
+static gnrc_netif_t _netif[SHM_RADIO_MAX];
+
+void auto_init_shm_radio(void)
+{
+    for (int i = 0; i < SHM_RADIO_MAX; i++) {
+        LOG_DEBUG("[auto_init_netif: initializing shared memory radio #%u\n", i);
+        /* setup netdev device */
+        shm_radio_setup(&_shm_radios[i], &shm_radio_params[i]);
+        gnrc_netif_ieee802154_create(&_netif[i], _shm_radio_stacks[i],
+                                     SHM_RADIO_MAC_STACKSIZE,
+                                     SHM_RADIO_MAC_PRIO, "shm_radio",
+                                     (netdev_t *)&_shm_radios[i]);
+    }
+}
+/** @} */
@@ -144,6 +144,11 @@ void gnrc_netif_init_devs(void)
         auto_init_socket_zep();
     }
 
+    if (IS_USED(MODULE_SHM_RADIO)) {
+        extern void auto_init_shm_radio(void);
+        auto_init_shm_radio();
+    }
+
     if (IS_USED(MODULE_NRFMIN)) {
         extern void gnrc_nrfmin_init(void);
         gnrc_nrfmin_init();
@@ -13,6 +13,7 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "assert.h"
@@ -30,13 +31,36 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#ifdef MODULE_GNRC_NETREG_HASH
+/* The registry as hash table by gnrc_nettype_t and demux context. Entries
+ * with the same type and demux context are kept adjacent within their bucket,
+ * so the next match of an entry is always its successor. */
+static gnrc_netreg_entry_t *netreg[CONFIG_GNRC_NETREG_HASH_NUMOF];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    /* multiplicative hashing; the type goes to the upper bits as most demux
+     * contexts (ports, protocol numbers) only use the lower 16 bits */
+    uint32_t key = (demux_ctx ^ ((uint32_t)type << 24)) * 2654435761U;
+
+    return &netreg[(key >> 16) % CONFIG_GNRC_NETREG_HASH_NUMOF];
+}
+
+static inline bool _match(const gnrc_netreg_entry_t *entry,
+                          gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    return (entry->nettype == type) && (entry->demux_ctx == demux_ctx);
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#endif
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -61,7 +85,27 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+    gnrc_netreg_entry_t *prev = NULL, *ptr = *bucket;
+
+    entry->nettype = type;
+    /* insert in front of entries with the same key, so they stay adjacent
+     * and are found in the same order as with the list */
+    while ((ptr != NULL) && !_match(ptr, type, entry->demux_ctx)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    entry->next = ptr;
+    if (prev == NULL) {
+        *bucket = entry;
+    }
+    else {
+        prev->next = entry;
+    }
+#else
     LL_PREPEND(netreg[type], entry);
+#endif
 
     return 0;
 }
@@ -72,7 +116,11 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
+#else
     LL_DELETE(netreg[type], entry);
+#endif
 }
 
 /**
@@ -93,10 +141,27 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
 {
     gnrc_netreg_entry_t *res = NULL;
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    if (from) {
+        /* entries with the same key are adjacent */
+        if ((from->next != NULL) &&
+            _match(from->next, from->nettype, from->demux_ctx)) {
+            res = from->next;
+        }
+    }
+    else if (!_INVALID_TYPE(type)) {
+        for (res = *_bucket(type, demux_ctx); res != NULL; res = res->next) {
+            if (_match(res, type, demux_ctx)) {
+                break;
+            }
+        }
+    }
+#else
     if (from || !_INVALID_TYPE(type)) {
         gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
+#endif
 
     return res;
 }
@@ -106,14 +171,25 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
     return _netreg_lookup(NULL, type, demux_ctx);
 }
 
-int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
+gnrc_netreg_entry_t *gnrc_netreg_lookup_num(gnrc_nettype_t type,
+                                            uint32_t demux_ctx, int *num)
 {
-    int num = 0;
-    gnrc_netreg_entry_t *entry = NULL;
+    gnrc_netreg_entry_t *res = _netreg_lookup(NULL, type, demux_ctx);
 
-    while((entry = _netreg_lookup(entry, type, demux_ctx)) != NULL) {
-        num++;
+    assert(num != NULL);
+    *num = 0;
+    for (gnrc_netreg_entry_t *entry = res; entry != NULL;
+         entry = _netreg_lookup(entry, type, demux_ctx)) {
+        (*num)++;
     }
+    return res;
+}
+
+int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    int num;
+
+    gnrc_netreg_lookup_num(type, demux_ctx, &num);
     return num;
 }
 
@@ -28,6 +28,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-lpm.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -38,6 +39,10 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+/* entries of a bucket are ordered as in _nodes */
+static _nib_onl_entry_t *_nodes_hash[CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS];
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
@@ -60,8 +65,12 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_nodes_hash, 0, sizeof(_nodes_hash));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    _nib_lpm_init();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -87,6 +96,45 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+static inline _nib_onl_entry_t **_hash_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* mix all bits in, neighbors often only differ in the last byte */
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3bU;
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3bU;
+    hash = (hash >> 16) ^ hash;
+    return &_nodes_hash[hash % CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS];
+}
+
+void _nib_onl_hash_add(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **ptr = _hash_bucket(&node->ipv6);
+
+    while ((*ptr != NULL) && (*ptr < node)) {
+        ptr = &(*ptr)->hash_next;
+    }
+    if (*ptr != node) {
+        node->hash_next = *ptr;
+        *ptr = node;
+    }
+}
+
+void _nib_onl_hash_remove(_nib_onl_entry_t *node)
+{
+    for (_nib_onl_entry_t **ptr = _hash_bucket(&node->ipv6); *ptr != NULL;
+         ptr = &(*ptr)->hash_next) {
+        if (*ptr == node) {
+            *ptr = node->hash_next;
+            node->hash_next = NULL;
+            return;
+        }
+    }
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -219,8 +267,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    for (_nib_onl_entry_t *node = *_hash_bucket(addr); node != NULL;
+         node = node->hash_next) {
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 
         if ((node->mode != _EMPTY) &&
             /* either requested or current interface undefined or
@@ -493,7 +546,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+                _nib_onl_hash_remove(tmp_node);
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _nib_onl_hash_add(tmp_node);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +569,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_lpm_add(dst);
     }
     return dst;
 }
@@ -550,6 +606,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_lpm_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -575,6 +632,11 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_LPM)
+    DEBUG("nib: get match for destination %s from LPM trie\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    return _nib_lpm_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_LPM */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
@@ -600,6 +662,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_LPM */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -824,11 +887,13 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+    _nib_onl_hash_remove(node);
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _nib_onl_hash_add(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -37,6 +37,7 @@
 #include "net/gnrc/ipv6/nib/ft.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib/conf.h"
+#include "net/gnrc/ipv6/nib/rc.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/ndp.h"
@@ -93,6 +94,14 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same bucket of the hash index
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+     */
+    struct _nib_onl_entry *hash_next;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -196,8 +205,17 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_LPM) || defined(DOXYGEN)
+    /**
+     * @brief   next off-link entry with the same prefix in the
+     *          longest-prefix match trie
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_LPM.
+     */
+    struct _nib_offl_entry *lpm_next;
+#endif
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
      * @brief   Event for @ref GNRC_IPV6_NIB_PFX_TIMEOUT
@@ -311,6 +329,33 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the hash index
+ *
+ * Must be called before _nib_onl_entry_t::ipv6 of @p node changes.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in,out] node  An entry. May not be in the hash index.
+ */
+void _nib_onl_hash_remove(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Adds an on-link entry to the hash index
+ *
+ * Must be called after _nib_onl_entry_t::ipv6 of @p node changed.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in,out] node  An entry. May already be in the hash index.
+ */
+void _nib_onl_hash_add(_nib_onl_entry_t *node);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nib_onl_hash_remove(node)  (void)node
+#define _nib_onl_hash_add(node)     (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,6 +367,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_hash_remove(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -766,6 +812,41 @@ _nib_offl_entry_t *_nib_abr_iter_pfx(const _nib_abr_entry_t *abr,
 _nib_abr_entry_t *_nib_abr_iter(const _nib_abr_entry_t *last);
 #endif
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC) || defined(DOXYGEN)
+/**
+ * @brief   Gets the cached next hop to a destination from the route cache
+ *
+ * @pre `(dst != NULL) && (nce != NULL)`
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_RC.
+ *
+ * @param[in] dst   A destination address.
+ * @param[in] iface The interface requested for @p dst (0 for any).
+ * @param[out] nce  Neighbor cache view on the next hop to @p dst.
+ *
+ * @return  true, if @p nce was set.
+ * @return  false, if @p dst is not in the route cache.
+ */
+bool _nib_rc_get(const ipv6_addr_t *dst, unsigned iface,
+                 gnrc_ipv6_nib_nc_t *nce);
+
+/**
+ * @brief   Adds the next hop to a destination to the route cache
+ *
+ * Replaces the oldest entry, if the cache is full.
+ *
+ * @pre `(dst != NULL) && (nce != NULL)`
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_RC.
+ *
+ * @param[in] dst   A destination address.
+ * @param[in] iface The interface requested for @p dst (0 for any).
+ * @param[in] nce   Neighbor cache view on the next hop to @p dst.
+ */
+void _nib_rc_add(const ipv6_addr_t *dst, unsigned iface,
+                 const gnrc_ipv6_nib_nc_t *nce);
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
+
 /**
  * @brief   Gets external forwarding table entry representation from off-link
  *          entry
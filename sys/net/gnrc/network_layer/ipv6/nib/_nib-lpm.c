@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+#include "_nib-lpm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_LPM)
+
+/**
+ * @brief   Number of trie nodes
+ *
+ * Every branching node has two children, so there is at most one branching
+ * node less than there are prefixes.
+ */
+#define _LPM_NODES_NUMOF    (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+/**
+ * @brief   Node of the longest-prefix match trie
+ */
+typedef struct _lpm_node {
+    /**
+     * @brief   Sub-tries, selected by the bit following the prefix
+     */
+    struct _lpm_node *child[2];
+    /**
+     * @brief   Off-link entries with this prefix, in the order of the NIB
+     *
+     * NULL for branching nodes, which always have both children.
+     */
+    _nib_offl_entry_t *entries;
+    ipv6_addr_t pfx;                /**< prefix of the node */
+    uint8_t pfx_len;                /**< length of _lpm_node_t::pfx in bits */
+} _lpm_node_t;
+
+static _lpm_node_t _lpm_nodes[_LPM_NODES_NUMOF];
+static _lpm_node_t *_root = NULL;
+/* released nodes, linked via _lpm_node_t::child[0] */
+static _lpm_node_t *_free_nodes = NULL;
+/* nodes in _lpm_nodes from this index on were never used */
+static unsigned _unused_nodes = 0;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 0x1;
+}
+
+static bool _matches(const ipv6_addr_t *pfx, const ipv6_addr_t *addr,
+                     unsigned pfx_len)
+{
+    unsigned bytes = pfx_len / 8;
+    unsigned bits = pfx_len % 8;
+
+    if (memcmp(pfx, addr, bytes) != 0) {
+        return false;
+    }
+    return (bits == 0) ||
+           (((pfx->u8[bytes] ^ addr->u8[bytes]) & (0xff << (8 - bits))) == 0);
+}
+
+static _lpm_node_t *_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _lpm_node_t *node;
+
+    if (_free_nodes != NULL) {
+        node = _free_nodes;
+        _free_nodes = node->child[0];
+    }
+    else {
+        /* can't happen, see _LPM_NODES_NUMOF */
+        assert(_unused_nodes < _LPM_NODES_NUMOF);
+        node = &_lpm_nodes[_unused_nodes++];
+    }
+    memset(node, 0, sizeof(_lpm_node_t));
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+static void _node_free(_lpm_node_t *node)
+{
+    node->child[0] = _free_nodes;
+    _free_nodes = node;
+}
+
+static void _node_add_entry(_lpm_node_t *node, _nib_offl_entry_t *entry)
+{
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    while ((*ptr != NULL) && (*ptr < entry)) {
+        ptr = &(*ptr)->lpm_next;
+    }
+    entry->lpm_next = *ptr;
+    *ptr = entry;
+}
+
+static bool _node_remove_entry(_lpm_node_t *node, _nib_offl_entry_t *entry)
+{
+    for (_nib_offl_entry_t **ptr = &node->entries; *ptr != NULL;
+         ptr = &(*ptr)->lpm_next) {
+        if (*ptr == entry) {
+            *ptr = entry->lpm_next;
+            entry->lpm_next = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline _lpm_node_t *_only_child(const _lpm_node_t *node)
+{
+    return (node->child[0] != NULL) ? node->child[0] : node->child[1];
+}
+
+void _nib_lpm_init(void)
+{
+    _root = NULL;
+    _free_nodes = NULL;
+    _unused_nodes = 0;
+}
+
+void _nib_lpm_add(_nib_offl_entry_t *entry)
+{
+    const ipv6_addr_t *pfx = &entry->pfx;
+    unsigned pfx_len = entry->pfx_len;
+    _lpm_node_t **ptr = &_root;
+
+    assert((entry->next_hop != NULL) && (pfx_len > 0) &&
+           (pfx_len <= IPV6_ADDR_BIT_LEN));
+    while (*ptr != NULL) {
+        _lpm_node_t *node = *ptr;
+        unsigned common = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+        common = (common < node->pfx_len) ? common : node->pfx_len;
+        common = (common < pfx_len) ? common : pfx_len;
+        if (common < node->pfx_len) {
+            /* prefix diverges from node (or is shorter): insert new node
+             * above it */
+            _lpm_node_t *parent = _node_alloc(pfx, common);
+
+            if (common == pfx_len) {
+                _node_add_entry(parent, entry);
+            }
+            else {
+                _lpm_node_t *leaf = _node_alloc(pfx, pfx_len);
+
+                _node_add_entry(leaf, entry);
+                parent->child[_bit(pfx, common)] = leaf;
+            }
+            parent->child[_bit(&node->pfx, common)] = node;
+            *ptr = parent;
+            return;
+        }
+        if (node->pfx_len == pfx_len) {
+            _node_add_entry(node, entry);
+            return;
+        }
+        ptr = &node->child[_bit(pfx, node->pfx_len)];
+    }
+    *ptr = _node_alloc(pfx, pfx_len);
+    _node_add_entry(*ptr, entry);
+}
+
+void _nib_lpm_remove(_nib_offl_entry_t *entry)
+{
+    _lpm_node_t **parent = NULL;
+    _lpm_node_t **ptr = &_root;
+    _lpm_node_t *node;
+
+    while ((*ptr != NULL) && ((*ptr)->pfx_len < entry->pfx_len)) {
+        parent = ptr;
+        ptr = &(*ptr)->child[_bit(&entry->pfx, (*ptr)->pfx_len)];
+    }
+    node = *ptr;
+    if ((node == NULL) || (node->pfx_len != entry->pfx_len) ||
+        !_matches(&node->pfx, &entry->pfx, node->pfx_len) ||
+        !_node_remove_entry(node, entry)) {
+        DEBUG("nib: %p not in LPM trie\n", (void *)entry);
+        return;
+    }
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node still required */
+        return;
+    }
+    *ptr = _only_child(node);
+    _node_free(node);
+    if ((*ptr == NULL) && (parent != NULL) && ((*parent)->entries == NULL)) {
+        /* branching parent lost one of its children */
+        node = *parent;
+        *parent = _only_child(node);
+        _node_free(node);
+    }
+}
+
+_nib_offl_entry_t *_nib_lpm_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _lpm_node_t *node = _root;
+
+    while ((node != NULL) && _matches(&node->pfx, dst, node->pfx_len)) {
+        _nib_offl_entry_t *entry = node->entries;
+
+        while ((entry != NULL) && (entry->mode == _EMPTY)) {
+            entry = entry->lpm_next;
+        }
+        /* the NIB compares destinations against the complete prefix
+         * addresses, so for prefixes only differing in length (e.g.
+         * 2001:db8::/32 and 2001:db8::/48) the one first in the NIB wins */
+        if ((entry != NULL) &&
+            !((res != NULL) && (res < entry) &&
+              ipv6_addr_equal(&res->pfx, &entry->pfx))) {
+            res = entry;
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->pfx_len)];
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_LPM */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_LPM */
+
+/** @} */
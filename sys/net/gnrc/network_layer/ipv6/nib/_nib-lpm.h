@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @{
+ *
+ * @file
+ * @brief   Definitions related to the longest-prefix match trie of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_LPM
+ *
+ * The trie is a path-compressed binary trie over the prefixes of all off-link
+ * entries in use. Each node stores a prefix, nodes with an off-link entry
+ * additionally link to all off-link entries with that prefix (e.g. a
+ * forwarding table entry and a prefix list entry for the same prefix). Nodes
+ * without an off-link entry only branch.
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef PRIV_NIB_LPM_H
+#define PRIV_NIB_LPM_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_LPM) || defined(DOXYGEN)
+/**
+ * @brief   Empties the longest-prefix match trie
+ */
+void _nib_lpm_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the longest-prefix match trie
+ *
+ * @pre     `(entry != NULL) && (entry->next_hop != NULL)`
+ * @pre     _nib_offl_entry_t::pfx and _nib_offl_entry_t::pfx_len of @p entry
+ *          are set and @p entry is not in the trie yet.
+ *
+ * @param[in] entry An off-link entry.
+ */
+void _nib_lpm_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the longest-prefix match trie
+ *
+ * @pre     `(entry != NULL)`
+ *
+ * @param[in] entry An off-link entry. May not be in the trie.
+ */
+void _nib_lpm_remove(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Off-link entries without a mode are ignored. If multiple off-link entries
+ * share the same prefix, the one first in the NIB is returned.
+ *
+ * @pre     `(dst != NULL)`
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no prefix matches @p dst.
+ */
+_nib_offl_entry_t *_nib_lpm_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_LPM || defined(DOXYGEN) */
+#define _nib_lpm_init()                     (void)0
+#define _nib_lpm_add(entry)                 (void)entry
+#define _nib_lpm_remove(entry)              (void)entry
+#endif  /* CONFIG_GNRC_IPV6_NIB_LPM || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_LPM_H */
+/** @} */
@@ -91,6 +91,7 @@ void gnrc_ipv6_nib_init(void)
     evtimer_event_t *tmp;
 
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     for (evtimer_event_t *ptr = _nib_evtimer.events;
          (ptr != NULL) && (tmp = (ptr->next), 1);
          ptr = tmp) {
@@ -127,6 +128,7 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
     assert(netif != NULL);
     DEBUG("nib: Initialize interface %u\n", netif->pid);
     gnrc_netif_acquire(netif);
+    gnrc_ipv6_nib_rc_flush();
 
     _init_iface_arsm(netif);
     netif->ipv6.retrans_time = NDP_RETRANS_TIMER_MS;
@@ -191,10 +193,21 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_ipv6_nib_nc_t *nce)
 {
     int res = 0;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+    unsigned req_iface = (netif == NULL) ? 0 : netif->pid;
+    bool cache = true;
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
 
     DEBUG("nib: get next hop link-layer address of %s%%%u\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
           (netif != NULL) ? (unsigned)netif->pid : 0U);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+    if (_nib_rc_get(dst, req_iface, nce)) {
+        DEBUG("nib: found %s in route cache\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        return 0;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
     gnrc_netif_acquire(netif);
     _nib_acquire();
     do {    /* XXX: hidden goto ;-) */
@@ -277,6 +290,11 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
                 _nib_dc_add(&route.next_hop, netif->pid, dst);
 #endif  /* CONFIG_GNRC_IPV6_NIB_DC */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC) && \
+    IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+                /* routing protocols need to be notified on every use */
+                cache = (netif->ipv6.route_info_cb == NULL);
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC && CONFIG_GNRC_IPV6_NIB_ROUTER */
             }
             else {
                 /* _resolve_addr releases pkt if not queued (in which case
@@ -285,6 +303,17 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
         }
     } while (0);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+    /* only cache neighbors that don't require neighbor unreachability
+     * detection to run on use */
+    if ((res == 0) && cache &&
+        ((gnrc_ipv6_nib_nc_get_nud_state(nce) ==
+          GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) ||
+         (gnrc_ipv6_nib_nc_get_nud_state(nce) ==
+          GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED))) {
+        _nib_rc_add(dst, req_iface, nce);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
     _nib_release();
     gnrc_netif_release(netif);
     return res;
@@ -297,6 +326,7 @@ void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
     assert(netif != NULL);
     gnrc_netif_acquire(netif);
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     switch (icmpv6->type) {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
         case ICMPV6_RTR_SOL:
@@ -335,6 +365,7 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
     DEBUG("nib: Handle timer event (ctx = %p, type = 0x%04x, now = %ums)\n",
           ctx, type, (unsigned)evtimer_now_msec());
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     switch (type) {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
         case GNRC_IPV6_NIB_SND_UC_NS:
@@ -407,6 +438,7 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
 void gnrc_ipv6_nib_change_rtr_adv_iface(gnrc_netif_t *netif, bool enable)
 {
     gnrc_netif_acquire(netif);
+    gnrc_ipv6_nib_rc_flush();
     if (enable) {
         _set_rtr_adv(netif);
     }
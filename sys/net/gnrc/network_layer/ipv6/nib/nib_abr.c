@@ -33,6 +33,7 @@ int gnrc_ipv6_nib_abr_add(const ipv6_addr_t *addr)
 
     assert(netif != NULL);
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     if ((abr = _nib_abr_add(addr)) == NULL) {
         _nib_release();
         return -ENOMEM;
@@ -63,6 +64,7 @@ int gnrc_ipv6_nib_abr_add(const ipv6_addr_t *addr)
 void gnrc_ipv6_nib_abr_del(const ipv6_addr_t *addr)
 {
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     _nib_abr_remove(addr);
     _nib_release();
 }
@@ -46,6 +46,7 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
         return -EINVAL;
     }
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     if (is_default_route) {
         _nib_dr_entry_t *ptr;
 
@@ -87,6 +88,7 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
 void gnrc_ipv6_nib_ft_del(const ipv6_addr_t *dst, unsigned dst_len)
 {
     _nib_acquire();
+    gnrc_ipv6_nib_rc_flush();
     if ((dst == NULL) || (dst_len == 0) || ipv6_addr_is_unspecified(dst)) {
         _nib_dr_entry_t *entry = _nib_drl_get_dr();
 
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/ipv6/nib/rc.h"
+
+#include "_nib-internal.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+
+/**
+ * @brief   Route cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination */
+    gnrc_ipv6_nib_nc_t nce;     /**< next hop to _rc_entry_t::dst */
+    uint32_t gen;               /**< generation of the entry */
+    uint16_t iface;             /**< requested interface (0 for any) */
+} _rc_entry_t;
+
+static _rc_entry_t _rc[CONFIG_GNRC_IPV6_NIB_RC_NUMOF];
+static gnrc_ipv6_nib_rc_stats_t _rc_stats;
+static mutex_t _rc_mutex = MUTEX_INIT;
+/* entries of other generations are invalid, so entries start invalid */
+static uint32_t _rc_gen = 1;
+/* next entry to replace if all are valid */
+static unsigned _rc_next = 0;
+
+static inline bool _is_valid(const _rc_entry_t *entry)
+{
+    return (entry->gen == _rc_gen);
+}
+
+bool _nib_rc_get(const ipv6_addr_t *dst, unsigned iface,
+                 gnrc_ipv6_nib_nc_t *nce)
+{
+    bool res = false;
+
+    mutex_lock(&_rc_mutex);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_RC_NUMOF; i++) {
+        _rc_entry_t *entry = &_rc[i];
+
+        if (_is_valid(entry) && (entry->iface == iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            memcpy(nce, &entry->nce, sizeof(entry->nce));
+            res = true;
+            break;
+        }
+    }
+    if (res) {
+        _rc_stats.hits++;
+    }
+    else {
+        _rc_stats.misses++;
+    }
+    mutex_unlock(&_rc_mutex);
+    return res;
+}
+
+void _nib_rc_add(const ipv6_addr_t *dst, unsigned iface,
+                 const gnrc_ipv6_nib_nc_t *nce)
+{
+    _rc_entry_t *entry = NULL;
+
+    mutex_lock(&_rc_mutex);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_RC_NUMOF; i++) {
+        _rc_entry_t *tmp = &_rc[i];
+
+        if (!_is_valid(tmp)) {
+            if (entry == NULL) {
+                entry = tmp;
+            }
+        }
+        else if ((tmp->iface == iface) && ipv6_addr_equal(&tmp->dst, dst)) {
+            /* may be added concurrently after two cache misses */
+            entry = tmp;
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &_rc[_rc_next];
+        _rc_next = (_rc_next + 1) % CONFIG_GNRC_IPV6_NIB_RC_NUMOF;
+    }
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    memcpy(&entry->nce, nce, sizeof(entry->nce));
+    entry->iface = iface;
+    entry->gen = _rc_gen;
+    mutex_unlock(&_rc_mutex);
+}
+
+void gnrc_ipv6_nib_rc_flush(void)
+{
+    mutex_lock(&_rc_mutex);
+    if (++_rc_gen == 0) {
+        /* invalidate entries of the first generation after wrap-around */
+        memset(_rc, 0, sizeof(_rc));
+        _rc_gen = 1;
+    }
+    _rc_next = 0;
+    _rc_stats.flushes++;
+    mutex_unlock(&_rc_mutex);
+}
+
+bool gnrc_ipv6_nib_rc_iter(void **state, gnrc_ipv6_nib_rc_t *entry)
+{
+    _rc_entry_t *ptr;
+    bool res = false;
+
+    assert((state != NULL) && (entry != NULL));
+    ptr = *state;
+    mutex_lock(&_rc_mutex);
+    for (ptr = (ptr == NULL) ? _rc : (ptr + 1);
+         ptr < (_rc + CONFIG_GNRC_IPV6_NIB_RC_NUMOF); ptr++) {
+        if (_is_valid(ptr)) {
+            memcpy(&entry->dst, &ptr->dst, sizeof(entry->dst));
+            memcpy(&entry->nce, &ptr->nce, sizeof(entry->nce));
+            *state = ptr;
+            res = true;
+            break;
+        }
+    }
+    mutex_unlock(&_rc_mutex);
+    return res;
+}
+
+void gnrc_ipv6_nib_rc_print(gnrc_ipv6_nib_rc_t *entry)
+{
+    char addr_str[(IPV6_ADDR_MAX_STR_LEN > CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN) ?
+                   IPV6_ADDR_MAX_STR_LEN : CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+
+    printf("%s ", ipv6_addr_to_str(addr_str, &entry->dst, sizeof(addr_str)));
+    if (!ipv6_addr_equal(&entry->dst, &entry->nce.ipv6)) {
+        printf("via %s ", ipv6_addr_to_str(addr_str, &entry->nce.ipv6,
+                                           sizeof(addr_str)));
+    }
+    printf("dev #%u lladdr %s\n", gnrc_ipv6_nib_nc_get_iface(&entry->nce),
+           gnrc_netif_addr_to_str(entry->nce.l2addr, entry->nce.l2addr_len,
+                                  addr_str));
+}
+
+void gnrc_ipv6_nib_rc_get_stats(gnrc_ipv6_nib_rc_stats_t *stats)
+{
+    assert(stats != NULL);
+    mutex_lock(&_rc_mutex);
+    memcpy(stats, &_rc_stats, sizeof(_rc_stats));
+    mutex_unlock(&_rc_mutex);
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_RC */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
+
+/** @} */
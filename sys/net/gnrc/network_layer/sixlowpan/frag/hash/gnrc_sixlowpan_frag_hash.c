@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "net/gnrc/sixlowpan/frag/hash.h"
+
+static unsigned _bucket(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    /* 32-bit FNV-1a over address and tag */
+    uint32_t h = 2166136261U;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        h = (h ^ src[i]) * 16777619U;
+    }
+    h = (h ^ (tag & 0xff)) * 16777619U;
+    h = (h ^ ((tag >> 8) & 0xff)) * 16777619U;
+    return h % CONFIG_GNRC_SIXLOWPAN_FRAG_HASH_NUMOF;
+}
+
+static void _unlink(gnrc_sixlowpan_frag_hash_t *hash, unsigned pos)
+{
+    gnrc_sixlowpan_frag_hash_link_t *link = &hash->links[pos];
+    uint16_t *ptr = &hash->head[link->bucket - 1];
+
+    while (*ptr != (pos + 1)) {
+        assert(*ptr != 0);
+        ptr = &hash->links[*ptr - 1].next;
+    }
+    *ptr = link->next;
+    link->next = 0;
+    link->bucket = 0;
+}
+
+void gnrc_sixlowpan_frag_hash_reset(gnrc_sixlowpan_frag_hash_t *hash,
+                                    unsigned links_numof)
+{
+    memset(hash->head, 0, sizeof(hash->head));
+    memset(hash->links, 0, links_numof * sizeof(hash->links[0]));
+}
+
+void gnrc_sixlowpan_frag_hash_set(gnrc_sixlowpan_frag_hash_t *hash,
+                                  unsigned pos, const uint8_t *src,
+                                  size_t src_len, unsigned tag)
+{
+    gnrc_sixlowpan_frag_hash_link_t *link = &hash->links[pos];
+    unsigned bucket = _bucket(src, src_len, tag);
+
+    assert(pos < UINT16_MAX);
+    if (link->bucket == (bucket + 1)) {
+        /* already in the right bucket */
+        return;
+    }
+    if (link->bucket != 0) {
+        _unlink(hash, pos);
+    }
+    link->bucket = bucket + 1;
+    link->next = hash->head[bucket];
+    hash->head[bucket] = pos + 1;
+}
+
+int gnrc_sixlowpan_frag_hash_first(const gnrc_sixlowpan_frag_hash_t *hash,
+                                   const uint8_t *src, size_t src_len,
+                                   unsigned tag)
+{
+    return (int)hash->head[_bucket(src, src_len, tag)] - 1;
+}
+
+/** @} */
@@ -26,6 +26,7 @@
 #ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
+#include "net/gnrc/sixlowpan/frag/hash.h"
 #include "net/gnrc/sixlowpan/frag/minfwd.h"
 #include "net/gnrc/sixlowpan/frag/vrb.h"
 #include "net/sixlowpan.h"
@@ -63,6 +64,11 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+static gnrc_sixlowpan_frag_hash_link_t _rbuf_hash_links[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static gnrc_sixlowpan_frag_hash_t _rbuf_hash = { .links = _rbuf_hash_links };
+#endif
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -180,6 +186,18 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
+static inline bool _rbuf_equal_index(const gnrc_sixlowpan_frag_rb_t *e,
+                                     const uint8_t *src, size_t src_len,
+                                     const uint8_t *dst, size_t dst_len,
+                                     uint16_t tag)
+{
+    return ((e->pkt != NULL) && (e->super.tag == tag) &&
+            (e->super.src_len == src_len) &&
+            (e->super.dst_len == dst_len) &&
+            (memcmp(e->super.src, src, src_len) == 0) &&
+            (memcmp(e->super.dst, dst, dst_len) == 0));
+}
+
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag)
 {
@@ -189,14 +207,15 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    for (int i = gnrc_sixlowpan_frag_hash_first(&_rbuf_hash, src, src_len, tag);
+         i >= 0; i = gnrc_sixlowpan_frag_hash_next(&_rbuf_hash, i)) {
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
         gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_equal_index(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
@@ -588,6 +607,44 @@ static inline void _set_rbuf_timeout(void)
                    &_gc_timer_msg, thread_getpid());
 }
 
+static inline bool _rbuf_equal(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               size_t size, uint16_t tag)
+{
+    return _rbuf_equal_index(e, src, src_len, dst, dst_len, tag) &&
+           ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             /* not all SFR fragments carry the datagram size, so make 0 a
+              * legal value to not compare datagram size */
+             ((size == 0) || (e->super.datagram_size == size))) ||
+            (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             (e->super.datagram_size == size)));
+}
+
+static int _rbuf_found(unsigned i, uint32_t now_usec)
+{
+    DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
+          gnrc_netif_addr_to_str(rbuf[i].super.src,
+                                 rbuf[i].super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u) found\n",
+          gnrc_netif_addr_to_str(rbuf[i].super.dst,
+                                 rbuf[i].super.dst_len,
+                                 l2addr_str),
+          (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+    if (rbuf[i].super.current_size == 0) {
+        /* ensure that only empty reassembly buffer entries and entries
+         * scheduled for deletion have `current_size == 0` */
+        DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+        return -1;
+    }
+#endif
+    rbuf[i].super.arrival = now_usec;
+    _set_rbuf_timeout();
+    return i;
+}
+
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
@@ -596,39 +653,22 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    /* check first if entry already available, only the entries in the
+     * datagram's bucket can match */
+    for (int i = gnrc_sixlowpan_frag_hash_first(&_rbuf_hash, src, src_len, tag);
+         i >= 0; i = gnrc_sixlowpan_frag_hash_next(&_rbuf_hash, i)) {
+        if (_rbuf_equal(&rbuf[i], src, src_len, dst, dst_len, size, tag)) {
+            return _rbuf_found(i, now_usec);
+        }
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
+
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) &&
+            _rbuf_equal(&rbuf[i], src, src_len, dst, dst_len, size, tag)) {
+            return _rbuf_found(i, now_usec);
         }
 
         /* if there is a free spot: remember it */
@@ -718,6 +758,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    gnrc_sixlowpan_frag_hash_set(&_rbuf_hash, res - &(rbuf[0]), src, src_len,
+                                 tag);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -748,6 +792,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    gnrc_sixlowpan_frag_hash_reset(&_rbuf_hash,
+                                   CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
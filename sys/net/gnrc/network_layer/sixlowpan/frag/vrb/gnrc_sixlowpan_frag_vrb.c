@@ -22,6 +22,7 @@
 #include "xtimer.h"
 
 #include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/gnrc/sixlowpan/frag/hash.h"
 #ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
@@ -31,6 +32,10 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+static gnrc_sixlowpan_frag_hash_link_t _vrb_hash_links[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static gnrc_sixlowpan_frag_hash_t _vrb_hash = { .links = _vrb_hash_links };
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,78 +51,96 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static gnrc_sixlowpan_frag_vrb_t *_get(const uint8_t *src, size_t src_len,
+                                       unsigned tag)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    for (int i = gnrc_sixlowpan_frag_hash_first(&_vrb_hash, src, src_len, tag);
+         i >= 0; i = gnrc_sixlowpan_frag_hash_next(&_vrb_hash, i)) {
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+
+        if (_equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+    }
+    return NULL;
+}
+
 
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
 
     assert(base != NULL);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+    if ((vrbe = _get(base->src, base->src_len, base->tag)) != NULL) {
+        /* _equal_index() => append intervals of `base`, so they don't get
+         * lost. We use append, so we don't need to change base! */
+        if (base->ints != NULL) {
+            gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
+            if (tmp != base->ints) {
+                /* base->ints is not already vrbe->super.ints */
+                if (tmp != NULL) {
+                    /* iterate before appending and check if `base->ints` is
+                     * not already part of list */
+                    while (tmp->next != NULL) {
+                        if (tmp == base->ints) {
+                            tmp = NULL;
+                            break;
                         }
+                        tmp = tmp->next;
                     }
-                    else {
-                        vrbe->super.ints = base->ints;
+                    if (tmp != NULL) {
+                        tmp->next = base->ints;
                     }
                 }
+                else {
+                    vrbe->super.ints = base->ints;
+                }
             }
-            break;
         }
+        return vrbe;
     }
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
-    if (vrbe == NULL) {
-        gnrc_sixlowpan_frag_stats_get()->vrb_full++;
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            vrbe = &_vrb[i];
+            vrbe->super = *base;
+            vrbe->out_netif = out_netif;
+            memcpy(vrbe->super.dst, out_dst, out_dst_len);
+            vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+            vrbe->super.dst_len = out_dst_len;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+            gnrc_sixlowpan_frag_hash_set(&_vrb_hash, i, base->src,
+                                         base->src_len, base->tag);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
+            DEBUG("6lo vrb: creating entry (%s, ",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str));
+            DEBUG("%s, %u, %u) => ",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str),
+                  (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+            DEBUG("(%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str), vrbe->out_tag);
+            return vrbe;
+        }
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_get()->vrb_full++;
 #endif
-    return vrbe;
+    return NULL;
 }
 
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(
@@ -167,18 +190,16 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
         const uint8_t *src, size_t src_len, unsigned src_tag)
 {
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
-
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if ((vrbe = _get(src, src_len, src_tag)) != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -232,6 +253,10 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH)
+    gnrc_sixlowpan_frag_hash_reset(&_vrb_hash,
+                                   CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) */
 }
 #endif
 
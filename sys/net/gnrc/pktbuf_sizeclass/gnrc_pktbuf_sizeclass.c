@@ -0,0 +1,636 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Size-class packet buffer implementation
+ *
+ * Packet snip headers live in a fixed slab of
+ * @ref CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF entries. Packet data is served
+ * from power-of-two size classes carved from a static pool with a binary buddy
+ * scheme: every size class has its own free list, so allocation and release
+ * are bounded by the (small, constant) number of size classes instead of the
+ * number of holes in the buffer.
+ *
+ * The pool is @ref CONFIG_GNRC_PKTBUF_SIZE, tiled by one block per set bit of
+ * its size, largest first. So the largest size class is the largest power of
+ * two that fits into the pool, and blocks never merge beyond the initial
+ * tiles.
+ *
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "bitarithm.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "trace_event.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* index of the most significant bit of a constant, for array sizes */
+#define _MSB2(x)            (((x) & 0x2UL) ? 1 : 0)
+#define _MSB4(x)            (((x) & 0xcUL) ? (2 + _MSB2((x) >> 2)) : _MSB2(x))
+#define _MSB8(x)            (((x) & 0xf0UL) ? (4 + _MSB4((x) >> 4)) : _MSB4(x))
+#define _MSB16(x)           (((x) & 0xff00UL) ? (8 + _MSB8((x) >> 8)) : _MSB8(x))
+#define _MSB32(x)           (((x) & 0xffff0000UL) ? (16 + _MSB16((x) >> 16)) \
+                                                  : _MSB16(x))
+
+#define _MIN_EXP            (CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP)
+#define _MIN_BLOCK          (1U << _MIN_EXP)
+#define _POOL_SIZE          ((CONFIG_GNRC_PKTBUF_SIZE >> _MIN_EXP) << _MIN_EXP)
+#define _MAX_EXP            (_MSB32((unsigned long)_POOL_SIZE))
+#define _MAX_BLOCK          (1U << _MAX_EXP)
+#define _ORDER_NUMOF        (_MAX_EXP - _MIN_EXP + 1)
+#define _UNIT_NUMOF         (_POOL_SIZE >> _MIN_EXP)
+#define _SNIP_NUMOF         (CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF)
+
+/* flags in the block map; the lower bits hold the order of the block */
+#define _MAP_ALLOC          (0x80U)
+#define _MAP_FREE           (0x40U)
+#define _MAP_ORDER_MASK     (0x3fU)
+
+typedef struct _free_block {
+    struct _free_block *next;
+    struct _free_block *prev;
+} _free_block_t;
+
+static_assert(_POOL_SIZE >= _MIN_BLOCK,
+              "CONFIG_GNRC_PKTBUF_SIZE must hold at least one smallest block");
+static_assert(_MIN_BLOCK >= sizeof(_free_block_t),
+              "CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP too small");
+static_assert(_ORDER_NUMOF <= _MAP_ORDER_MASK,
+              "too many size classes");
+static_assert(_SNIP_NUMOF > 0,
+              "CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF must not be 0");
+
+static mutex_t _mutex = MUTEX_INIT;
+/* word aligned so that free blocks can hold _free_block_t */
+static uintptr_t _pool_buf[_POOL_SIZE / sizeof(uintptr_t)];
+static uint8_t *const _pool = (uint8_t *)_pool_buf;
+/* one entry per smallest block: order and state of the block starting there,
+ * 0 for units inside a block */
+static uint8_t _map[_UNIT_NUMOF];
+static _free_block_t *_free_lists[_ORDER_NUMOF];
+static gnrc_pktsnip_t _snips[_SNIP_NUMOF];
+static gnrc_pktsnip_t *_free_snips;
+
+static struct {
+    size_t bytes_used;      /**< data bytes currently in blocks */
+    size_t bytes_max;       /**< high-water mark of bytes_used */
+    unsigned snips_used;    /**< snip headers currently in use */
+    unsigned snips_max;     /**< high-water mark of snips_used */
+    unsigned alloc_fails;   /**< failed data or snip allocations */
+} _stats;
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_free(void *data);
+static void _pktbuf_shrink(void *data, size_t size);
+
+static inline bool _pool_contains(const void *ptr)
+{
+    return (size_t)((const uint8_t *)ptr - _pool) < _POOL_SIZE;
+}
+
+static inline bool _slab_contains(const gnrc_pktsnip_t *pkt)
+{
+    return (size_t)(pkt - _snips) < _SNIP_NUMOF;
+}
+
+static inline size_t _block_size(unsigned order)
+{
+    return _MIN_BLOCK << order;
+}
+
+static inline unsigned _unit(const void *ptr)
+{
+    return ((const uint8_t *)ptr - _pool) >> _MIN_EXP;
+}
+
+static inline void *_unit_ptr(unsigned unit)
+{
+    return &_pool[unit << _MIN_EXP];
+}
+
+/* smallest size class that can hold size bytes, size must be > 0 */
+static inline unsigned _order_for(size_t size)
+{
+    if (size <= _MIN_BLOCK) {
+        return 0;
+    }
+    return bitarithm_msb((size - 1) >> _MIN_EXP) + 1;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static void _push_free(unsigned unit, unsigned order)
+{
+    _free_block_t *block = _unit_ptr(unit);
+
+    block->prev = NULL;
+    block->next = _free_lists[order];
+    if (block->next != NULL) {
+        block->next->prev = block;
+    }
+    _free_lists[order] = block;
+    _map[unit] = _MAP_FREE | order;
+}
+
+static void _remove_free(unsigned unit, unsigned order)
+{
+    _free_block_t *block = _unit_ptr(unit);
+
+    if (block->prev == NULL) {
+        _free_lists[order] = block->next;
+    }
+    else {
+        block->prev->next = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+    _map[unit] = 0;
+}
+
+/* finds the allocated block containing ptr, returns its first unit */
+static int _find_block(const void *ptr, unsigned *order)
+{
+    unsigned unit = _unit(ptr);
+
+    for (unsigned k = 0; k < _ORDER_NUMOF; k++) {
+        unsigned start = unit & ~((1U << k) - 1);
+
+        if (_map[start] == (_MAP_ALLOC | k)) {
+            *order = k;
+            return start;
+        }
+    }
+    return -1;
+}
+
+static inline void _account(ssize_t bytes)
+{
+    _stats.bytes_used += bytes;
+    if (_stats.bytes_used > _stats.bytes_max) {
+        _stats.bytes_max = _stats.bytes_used;
+    }
+}
+
+static gnrc_pktsnip_t *_snip_alloc(void)
+{
+    gnrc_pktsnip_t *pkt = _free_snips;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: no snip header left in slab\n");
+        _stats.alloc_fails++;
+        return NULL;
+    }
+    _free_snips = pkt->next;
+    if (++_stats.snips_used > _stats.snips_max) {
+        _stats.snips_max = _stats.snips_used;
+    }
+    return pkt;
+}
+
+static void _snip_free(gnrc_pktsnip_t *pkt)
+{
+    pkt->next = _free_snips;
+    _free_snips = pkt;
+    _stats.snips_used--;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    memset(_map, 0, sizeof(_map));
+    memset(_free_lists, 0, sizeof(_free_lists));
+    for (unsigned k = _ORDER_NUMOF, unit = 0; k > 0; k--) {
+        if (_UNIT_NUMOF & (1U << (k - 1))) {
+            _push_free(unit, k - 1);
+            unit += 1U << (k - 1);
+        }
+    }
+    _free_snips = NULL;
+    for (unsigned i = 0; i < _SNIP_NUMOF; i++) {
+        _snips[i].next = _free_snips;
+        _free_snips = &_snips[i];
+    }
+    memset(&_stats, 0, sizeof(_stats));
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _MAX_BLOCK) {
+        DEBUG("pktbuf: size (%u) > largest size class (%u)\n",
+              (unsigned)size, _MAX_BLOCK);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _snip_alloc();
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        /* marked section takes the whole block */
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else {
+        /* a block can only have one owner: copy the (usually small) marked
+         * header into a block of its own and leave the remainder in place */
+        new_data_marked = _pktbuf_alloc(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _snip_free(marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pool_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size */
+    else if (size > pkt->size) {
+        unsigned order;
+        int start = (pkt->data != NULL) ? _find_block(pkt->data, &order) : -1;
+
+        /* grow in place if the block has enough room behind the data */
+        if ((start < 0) ||
+            ((size_t)(((uint8_t *)_unit_ptr(start) + _block_size(order)) -
+                      (uint8_t *)pkt->data) < size)) {
+            void *new_data = (size <= _MAX_BLOCK) ? _pktbuf_alloc(size) : NULL;
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {            /* if old data exist */
+                memcpy(new_data, pkt->data, pkt->size);
+                _pktbuf_free(pkt->data);
+            }
+            pkt->data = new_data;
+        }
+    }
+    else {
+        _pktbuf_shrink(pkt->data, size);
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_contains(pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            TRACE_EVENT(TRACE_EVENT_PKTBUF_FREE, pkt->size, (uintptr_t)pkt);
+            _pktbuf_free(pkt->data);
+            _snip_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+/* order of the initial tile of the pool containing unit */
+static unsigned _tile_order(unsigned unit)
+{
+    unsigned start = 0;
+
+    for (unsigned k = _ORDER_NUMOF; k > 0; k--) {
+        if (_UNIT_NUMOF & (1U << (k - 1))) {
+            start += 1U << (k - 1);
+            if (unit < start) {
+                return k - 1;
+            }
+        }
+    }
+    return 0;
+}
+
+void gnrc_pktbuf_stats(void)
+{
+    size_t free_bytes, split_bytes = 0;
+
+    mutex_lock(&_mutex);
+    free_bytes = _POOL_SIZE - _stats.bytes_used;
+    printf("packet buffer: %u data bytes in %u size classes (%u..%u), "
+           "%u snip headers\n", (unsigned)_POOL_SIZE, (unsigned)_ORDER_NUMOF,
+           _MIN_BLOCK, _MAX_BLOCK, (unsigned)_SNIP_NUMOF);
+    printf("  data bytes used: %u (max: %u)\n",
+           (unsigned)_stats.bytes_used, (unsigned)_stats.bytes_max);
+    printf("  snips used: %u (max: %u)\n",
+           _stats.snips_used, _stats.snips_max);
+    printf("  failed allocations: %u\n", _stats.alloc_fails);
+    for (unsigned k = 0; k < _ORDER_NUMOF; k++) {
+        unsigned count = 0;
+
+        for (_free_block_t *b = _free_lists[k]; b != NULL; b = b->next) {
+            count++;
+            if (k < _tile_order(_unit(b))) {
+                split_bytes += _block_size(k);
+            }
+        }
+        printf("  class %4u: %u free\n", (unsigned)_block_size(k), count);
+    }
+    /* share of free memory in blocks split below their initial tile */
+    printf("  fragmentation: %u%%\n", (free_bytes == 0) ? 0 :
+           (unsigned)((split_bytes * 100) / free_bytes));
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    return (_stats.bytes_used == 0) && (_stats.snips_used == 0);
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    unsigned free_count[_ORDER_NUMOF] = { 0 };
+    size_t used = 0;
+    unsigned unit = 0;
+
+    /* Invariants of this implementation:
+     *  - the pool is tiled completely by blocks, each starting at a unit
+     *    aligned to its own size, with all inner units marked 0
+     *  - every free block is in the free list of its order and vice versa
+     *  - no two free buddies of the same order exist (they would be merged)
+     *  - the sum of allocated block sizes equals the accounted bytes
+     */
+    while (unit < _UNIT_NUMOF) {
+        unsigned order = _map[unit] & _MAP_ORDER_MASK;
+        unsigned units;
+
+        if (!(_map[unit] & (_MAP_ALLOC | _MAP_FREE)) ||
+            (order >= _ORDER_NUMOF) || (unit & ((1U << order) - 1))) {
+            return false;
+        }
+        units = 1U << order;
+        for (unsigned i = 1; i < units; i++) {
+            if (_map[unit + i] != 0) {
+                return false;
+            }
+        }
+        if (_map[unit] & _MAP_FREE) {
+            if ((order < (_ORDER_NUMOF - 1)) && ((unit ^ units) < _UNIT_NUMOF) &&
+                (_map[unit ^ units] == (_MAP_FREE | order))) {
+                return false;
+            }
+            free_count[order]++;
+        }
+        else {
+            used += _block_size(order);
+        }
+        unit += units;
+    }
+    for (unsigned k = 0; k < _ORDER_NUMOF; k++) {
+        for (_free_block_t *b = _free_lists[k]; b != NULL; b = b->next) {
+            if (!_pool_contains(b) || (_map[_unit(b)] != (_MAP_FREE | k))) {
+                return false;
+            }
+            free_count[k]--;
+        }
+        if (free_count[k] != 0) {
+            return false;
+        }
+    }
+    return used == _stats.bytes_used;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _snip_alloc();
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _snip_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    TRACE_EVENT(TRACE_EVENT_PKTBUF_ALLOC, size, (uintptr_t)pkt);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    unsigned order = _order_for(size);
+    unsigned k = order;
+    unsigned unit;
+
+    assert(size <= _MAX_BLOCK);
+    while ((k < _ORDER_NUMOF) && (_free_lists[k] == NULL)) {
+        k++;
+    }
+    if (k == _ORDER_NUMOF) {
+        DEBUG("pktbuf: no block of size %u left in packet buffer\n",
+              (unsigned)_block_size(order));
+        _stats.alloc_fails++;
+        return NULL;
+    }
+    unit = _unit(_free_lists[k]);
+    _remove_free(unit, k);
+    /* split larger block, putting the upper halves back */
+    while (k > order) {
+        k--;
+        _push_free(unit + (1U << k), k);
+    }
+    _map[unit] = _MAP_ALLOC | order;
+    _account(_block_size(order));
+    return _unit_ptr(unit);
+}
+
+static void _pktbuf_free(void *data)
+{
+    unsigned order;
+    int start;
+    unsigned unit;
+
+    if ((data == NULL) || !_pool_contains(data)) {
+        return;
+    }
+    start = _find_block(data, &order);
+    assert(start >= 0);
+    unit = (unsigned)start;
+    _account(-(ssize_t)_block_size(order));
+    /* merge with free buddies as far as possible */
+    while (order < (_ORDER_NUMOF - 1)) {
+        unsigned buddy = unit ^ (1U << order);
+
+        /* the last tiles of the pool have no buddy */
+        if ((buddy >= _UNIT_NUMOF) || (_map[buddy] != (_MAP_FREE | order))) {
+            break;
+        }
+        _remove_free(buddy, order);
+        _map[unit] = 0;
+        unit &= buddy;
+        order++;
+    }
+    _push_free(unit, order);
+}
+
+static void _pktbuf_shrink(void *data, size_t size)
+{
+    unsigned order;
+    int start;
+    size_t needed;
+
+    assert((data != NULL) && (size > 0));
+    start = _find_block(data, &order);
+    assert(start >= 0);
+    needed = ((uint8_t *)data - (uint8_t *)_unit_ptr(start)) + size;
+    /* give back upper halves that are not needed anymore; their buddy (the
+     * lower half) stays allocated so they can't be merged */
+    while ((order > 0) && (needed <= _block_size(order - 1))) {
+        order--;
+        _push_free(start + (1U << order), order);
+        _account(-(ssize_t)_block_size(order));
+    }
+    _map[start] = _MAP_ALLOC | order;
+}
+
+/** @} */
@@ -29,6 +29,7 @@
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#include "trace_event.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -231,6 +232,7 @@ static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
         tmp = pkt->next;
         if (pkt->users == 1) {
             pkt->users = 0; /* not necessary but to be on the safe side */
+            TRACE_EVENT(TRACE_EVENT_PKTBUF_FREE, pkt->size, (uintptr_t)pkt);
             _pktbuf_free(pkt->data, pkt->size);
             _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
         }
@@ -402,6 +404,7 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
         }
     }
     _set_pktsnip(pkt, next, _data, size, type);
+    TRACE_EVENT(TRACE_EVENT_PKTBUF_ALLOC, size, (uintptr_t)pkt);
     return pkt;
 }
 
@@ -26,7 +26,6 @@
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netreg.h"
-#include "net/iana/portrange.h"
 #include "net/sock/ip.h"
 
 #include "sock_types.h"
@@ -35,26 +34,6 @@
 extern "C" {
 #endif
 
-/**
- * @brief   Minimum port number in the dynamic portrange
- */
-#define GNRC_SOCK_DYN_PORTRANGE_MIN (IANA_DYNAMIC_PORTRANGE_MIN)
-/**
- * @brief   Maximum port number in the dynamic portrange
- */
-#define GNRC_SOCK_DYN_PORTRANGE_MAX (IANA_DYNAMIC_PORTRANGE_MAX)
-
-/**
- * @brief   Available ports in the range for dynamic source port allocation
- */
-#define GNRC_SOCK_DYN_PORTRANGE_NUM (GNRC_SOCK_DYN_PORTRANGE_MAX - GNRC_SOCK_DYN_PORTRANGE_MIN + 1)
-
-/**
- * @brief   Error value indicating that no free port could be found in the
- *          dynamic port range
- */
-#define GNRC_SOCK_DYN_PORTRANGE_ERR (0)
-
 /**
  * @brief   Structure to retrieve auxiliary data from @ref gnrc_sock_recv
  *
@@ -134,6 +134,7 @@ struct sock_udp {
     sock_udp_ep_t local;                   /**< local end-point */
     sock_udp_ep_t remote;                  /**< remote end-point */
     uint16_t flags;                        /**< option flags */
+    bool port_alloc;                       /**< local port needs to be released */
 };
 
 #ifdef __cplusplus
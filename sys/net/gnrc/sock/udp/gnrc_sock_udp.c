@@ -23,10 +23,11 @@
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/port_alloc.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
-#include "random.h"
 
 #include "gnrc_sock_internal.h"
 
@@ -34,53 +35,21 @@
 static sock_udp_t *_udp_socks = NULL;
 #endif
 
-/**
- * @brief   Checks if a given UDP port is already used by another sock
- */
-static bool _dyn_port_used(uint16_t port)
+static bool _port_in_use(uint16_t port)
 {
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
-         ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
-            continue;
-        }
-        if (ptr->local.port == port) {
-            /* port already in use by another sock */
-            return true;
-        }
-    }
-#else
-    (void) port;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
-    return false;
+    /* covers sockets sharing a port with SOCK_FLAGS_REUSE_EP and ports
+     * registered directly with netreg */
+    return (gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port) != NULL);
 }
 
-/**
- * @brief   returns a UDP port, and checks for reuse if required
- *
- * implements "Another Simple Port Randomization Algorithm" as specified in
- * RFC 6056, see https://tools.ietf.org/html/rfc6056#section-3.3.2
- */
-static uint16_t _get_dyn_port(sock_udp_t *sock)
+static gnrc_port_alloc_t _ports = GNRC_PORT_ALLOC_INIT(_port_in_use);
+
+static void _release_port(sock_udp_t *sock)
 {
-    unsigned count = GNRC_SOCK_DYN_PORTRANGE_NUM;
-    do {
-        uint16_t port = GNRC_SOCK_DYN_PORTRANGE_MIN +
-               (random_uint32() % GNRC_SOCK_DYN_PORTRANGE_NUM);
-        if ((sock && (sock->flags & SOCK_FLAGS_REUSE_EP)) || !_dyn_port_used(port)) {
-            return port;
-        }
-        --count;
-    } while (count > 0);
-    return GNRC_SOCK_DYN_PORTRANGE_ERR;
+    if (sock->port_alloc) {
+        gnrc_port_alloc_release(&_ports, sock->local.port);
+        sock->port_alloc = false;
+    }
 }
 
 int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
@@ -95,6 +64,7 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
         return -EINVAL;
     }
     memset(&sock->local, 0, sizeof(sock_udp_ep_t));
+    sock->port_alloc = false;
     if (local != NULL) {
         uint16_t port = local->port;
 
@@ -102,20 +72,28 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
             return -EAFNOSUPPORT;
         }
         if (port == 0U) {
-            port = _get_dyn_port(sock);
-            if (port == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+            port = gnrc_port_alloc_get(&_ports);
+            if (port == GNRC_PORT_ALLOC_ERR) {
                 return -EADDRINUSE;
             }
+            sock->port_alloc = true;
         }
+        else {
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-        else if (!(flags & SOCK_FLAGS_REUSE_EP)) {
-            for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
-                 ptr = (sock_udp_t *)ptr->reg.next) {
-                if (memcmp(&ptr->local, local, sizeof(sock_udp_ep_t)) == 0) {
-                    return -EADDRINUSE;
+            if (!(flags & SOCK_FLAGS_REUSE_EP)) {
+                for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+                     ptr = (sock_udp_t *)ptr->reg.next) {
+                    if (memcmp(&ptr->local, local,
+                               sizeof(sock_udp_ep_t)) == 0) {
+                        return -EADDRINUSE;
+                    }
                 }
             }
+#endif
+            /* keep explicitly bound ports from being allocated */
+            sock->port_alloc = gnrc_port_alloc_reserve(&_ports, port);
         }
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
         /* prepend to current socks */
         sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
         _udp_socks = sock;
@@ -126,9 +104,11 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
     memset(&sock->remote, 0, sizeof(sock_udp_ep_t));
     if (remote != NULL) {
         if (gnrc_af_not_supported(remote->family)) {
+            _release_port(sock);
             return -EAFNOSUPPORT;
         }
         if (gnrc_ep_addr_any((const sock_ip_ep_t *)remote)) {
+            _release_port(sock);
             return -EINVAL;
         }
         gnrc_ep_set((sock_ip_ep_t *)&sock->remote,
@@ -146,6 +126,7 @@ void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+    _release_port(sock);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
     if (_udp_socks != NULL) {
         gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
@@ -273,6 +254,35 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                       unsigned msgs_numof, uint32_t timeout)
+{
+    unsigned received = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (msgs_numof > 0));
+    while (received < msgs_numof) {
+        sock_udp_mmsg_t *msg = &msgs[received];
+        /* only wait for the first datagram, then just drain the mbox */
+        ssize_t res = sock_udp_recv_aux(sock, msg->data, msg->len,
+                                        (received == 0) ? timeout : 0,
+                                        msg->remote, NULL);
+
+        if (res < 0) {
+            if (received == 0) {
+                return res;
+            }
+            else if (res == -EPROTO) {
+                /* datagram from wrong remote was dropped, try next one */
+                continue;
+            }
+            break;
+        }
+        msg->len = res;
+        received++;
+    }
+    return received;
+}
+
 ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
@@ -313,7 +323,7 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
         memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        if ((src_port = gnrc_port_alloc_get(&_ports)) == GNRC_PORT_ALLOC_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -322,6 +332,7 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         if (sock != NULL) {
             /* bind sock object implicitly */
             sock->local.port = src_port;
+            sock->port_alloc = true;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
@@ -335,6 +346,10 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
             _udp_socks = sock;
 #endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
         }
+        else {
+            /* the port is only used for this datagram */
+            gnrc_port_alloc_release(&_ports, src_port);
+        }
     }
     else {
         src_port = sock->local.port;
@@ -380,6 +395,21 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     return res;
 }
 
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_mmsg_t *msgs,
+                       unsigned msgs_numof)
+{
+    assert((msgs != NULL) && (msgs_numof > 0));
+    for (unsigned i = 0; i < msgs_numof; i++) {
+        ssize_t res = sock_udp_send_aux(sock, msgs[i].data, msgs[i].len,
+                                        msgs[i].remote, NULL);
+
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+    }
+    return msgs_numof;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+
+#include "random.h"
+
+#include "net/gnrc/port_alloc.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+static_assert((CONFIG_GNRC_PORT_ALLOC_NUMOF % 8) == 0,
+              "CONFIG_GNRC_PORT_ALLOC_NUMOF must be a multiple of 8");
+static_assert((CONFIG_GNRC_PORT_ALLOC_NUMOF > 0) &&
+              (CONFIG_GNRC_PORT_ALLOC_NUMOF <=
+               (IANA_DYNAMIC_PORTRANGE_MAX - IANA_DYNAMIC_PORTRANGE_MIN + 1)),
+              "CONFIG_GNRC_PORT_ALLOC_NUMOF exceeds dynamic port range");
+
+static inline bool _in_range(uint16_t port)
+{
+    return (port >= GNRC_PORT_ALLOC_MIN) &&
+           ((unsigned)(port - GNRC_PORT_ALLOC_MIN) <
+            CONFIG_GNRC_PORT_ALLOC_NUMOF);
+}
+
+uint16_t gnrc_port_alloc_get(gnrc_port_alloc_t *ports)
+{
+    uint16_t res = GNRC_PORT_ALLOC_ERR;
+
+    assert(ports != NULL);
+    mutex_lock(&ports->lock);
+    /* RFC 6056, section 3.3.2: draw a new random port on every collision */
+    for (unsigned count = CONFIG_GNRC_PORT_ALLOC_NUMOF;
+         (count > 0) && (ports->numof_used < CONFIG_GNRC_PORT_ALLOC_NUMOF);
+         count--) {
+        unsigned idx = random_uint32_range(0, CONFIG_GNRC_PORT_ALLOC_NUMOF);
+
+        if (bf_isset(ports->used, idx)) {
+            continue;
+        }
+        if ((ports->in_use != NULL) &&
+            ports->in_use(GNRC_PORT_ALLOC_MIN + idx)) {
+            DEBUG("port_alloc: port %u bound outside of allocator\n",
+                  GNRC_PORT_ALLOC_MIN + idx);
+            continue;
+        }
+        bf_set(ports->used, idx);
+        ports->numof_used++;
+        res = GNRC_PORT_ALLOC_MIN + idx;
+        break;
+    }
+    mutex_unlock(&ports->lock);
+    DEBUG("port_alloc: allocated port %u\n", res);
+    return res;
+}
+
+bool gnrc_port_alloc_reserve(gnrc_port_alloc_t *ports, uint16_t port)
+{
+    bool res = false;
+
+    assert(ports != NULL);
+    if (_in_range(port)) {
+        unsigned idx = port - GNRC_PORT_ALLOC_MIN;
+
+        mutex_lock(&ports->lock);
+        if (!bf_isset(ports->used, idx)) {
+            bf_set(ports->used, idx);
+            ports->numof_used++;
+            res = true;
+        }
+        mutex_unlock(&ports->lock);
+    }
+    return res;
+}
+
+void gnrc_port_alloc_release(gnrc_port_alloc_t *ports, uint16_t port)
+{
+    assert(ports != NULL);
+    if (_in_range(port)) {
+        unsigned idx = port - GNRC_PORT_ALLOC_MIN;
+
+        mutex_lock(&ports->lock);
+        if (bf_isset(ports->used, idx)) {
+            bf_unset(ports->used, idx);
+            ports->numof_used--;
+        }
+        mutex_unlock(&ports->lock);
+        DEBUG("port_alloc: released port %u\n", port);
+    }
+}
+
+/** @} */
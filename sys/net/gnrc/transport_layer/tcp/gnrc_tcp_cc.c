@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_cc.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief Upper bound of the initial window (see RFC 5681, section 3.1)
+ */
+#define INITIAL_WINDOW_MAX  (4380U)
+
+/**
+ * @brief Calculates the sender maximum segment size (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Size of the largest segment that can be sent to the peer.
+ */
+static inline uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    if ((tcb->mss > 0) && (tcb->mss < CONFIG_GNRC_TCP_MSS)) {
+        return tcb->mss;
+    }
+    return CONFIG_GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Calculates the amount of data in flight.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of unacknowledged bytes.
+ */
+static inline uint32_t _flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+/**
+ * @brief Halves the amount of data in flight after a loss was detected
+ *        (see RFC 5681, equation 4).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _reduce_ssthresh(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t ssthresh = _flight_size(tcb) / 2;
+
+    tcb->ssthresh = (ssthresh > 2 * _smss(tcb)) ? ssthresh : 2 * _smss(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->dupacks = 0;
+}
+
+/**
+ * @brief Retransmits the oldest packet the peer did not receive.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _retransmit_hole(gnrc_tcp_tcb_t *tcb)
+{
+    for (unsigned i = 0; i < tcb->queue_len; i++) {
+#ifdef MODULE_GNRC_TCP_SACK
+        if (tcb->sacked & (1UL << i)) {
+            continue;
+        }
+#endif
+        TCP_DEBUG_INFO("Retransmit segment.");
+        _gnrc_tcp_pkt_resend(tcb, tcb->pkt_queue[i]);
+        return;
+    }
+}
+
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    /* Initial window (see RFC 5681, equation 1) */
+    if (4 * smss < INITIAL_WINDOW_MAX) {
+        tcb->cwnd = 4 * smss;
+    }
+    else if (2 * smss > INITIAL_WINDOW_MAX) {
+        tcb->cwnd = 2 * smss;
+    }
+    else {
+        tcb->cwnd = INITIAL_WINDOW_MAX;
+    }
+    /* Start with an arbitrarily high slow start threshold */
+    tcb->ssthresh = UINT32_MAX;
+    tcb->dupacks = 0;
+    tcb->status &= ~(STATUS_FAST_RECOVERY | STATUS_LOSS_RECOVERY);
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_cc_get_send_window(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = (tcb->cwnd < tcb->snd_wnd) ? tcb->cwnd : tcb->snd_wnd;
+    uint32_t flight_size = _flight_size(tcb);
+
+    return (wnd > flight_size) ? (wnd - flight_size) : 0;
+}
+
+void _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    tcb->dupacks = 0;
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+            /* Partial ACK: the next segment was lost as well (RFC 6582, 3.2 (5)) */
+            _retransmit_hole(tcb);
+            tcb->cwnd -= (acked < tcb->cwnd) ? acked : tcb->cwnd;
+            if (acked >= smss) {
+                tcb->cwnd += smss;
+            }
+        }
+        else {
+            /* Full ACK: deflate the window, leave fast recovery */
+            TCP_DEBUG_INFO("Leave fast recovery.");
+            tcb->cwnd = tcb->ssthresh;
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+        }
+    }
+    else {
+        if (tcb->status & STATUS_LOSS_RECOVERY) {
+            /* The segments sent before the timeout are likely lost as well */
+            if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+                _retransmit_hole(tcb);
+            }
+            else {
+                tcb->status &= ~STATUS_LOSS_RECOVERY;
+            }
+        }
+        if (tcb->cwnd < tcb->ssthresh) {
+            /* Slow start (RFC 5681, equation 2) */
+            tcb->cwnd += (acked < smss) ? acked : smss;
+        }
+        else {
+            /* Congestion avoidance (RFC 5681, equation 3) */
+            uint32_t inc = (smss * smss) / tcb->cwnd;
+            tcb->cwnd += (inc > 0) ? inc : 1;
+        }
+    }
+    /* The window moved on: allow the user to send more data */
+    tcb->status |= STATUS_NOTIFY_USER;
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_cc_dupack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Only ACKs for outstanding data count (RFC 5681, section 2) */
+    if (tcb->queue_len == 0) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    tcb->dupacks++;
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Inflate the window for every segment that left the network */
+        tcb->cwnd += _smss(tcb);
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+    else if ((tcb->dupacks == CONFIG_GNRC_TCP_DUPACK_THRESHOLD) &&
+             !((tcb->status & STATUS_LOSS_RECOVERY) &&
+               LSS_32_BIT(tcb->snd_una, tcb->recover))) {
+        /* Fast retransmit (RFC 5681, section 3.2), but only once for the
+         * segments sent before the last loss (RFC 6582, section 3.2 (2)) */
+        TCP_DEBUG_INFO("Enter fast recovery.");
+        _reduce_ssthresh(tcb);
+        tcb->dupacks = CONFIG_GNRC_TCP_DUPACK_THRESHOLD;
+        _retransmit_hole(tcb);
+        tcb->cwnd = tcb->ssthresh + CONFIG_GNRC_TCP_DUPACK_THRESHOLD * _smss(tcb);
+        tcb->status &= ~STATUS_LOSS_RECOVERY;
+        tcb->status |= STATUS_FAST_RECOVERY;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Don't reduce ssthresh again, if the retransmission got lost (RFC 5681, 3.1) */
+    if (!(tcb->status & STATUS_LOSS_RECOVERY)) {
+        _reduce_ssthresh(tcb);
+    }
+    tcb->cwnd = _smss(tcb);
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+    tcb->status |= STATUS_LOSS_RECOVERY;
+#ifdef MODULE_GNRC_TCP_SACK
+    /* The peer may have discarded selectively acknowledged data (RFC 2018, 8) */
+    tcb->sacked = 0;
+#endif
+    TCP_DEBUG_LEAVE;
+}
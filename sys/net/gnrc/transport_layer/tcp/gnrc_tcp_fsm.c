@@ -22,6 +22,7 @@
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
+#include "net/gnrc/port_alloc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
@@ -31,6 +32,10 @@
 #include "include/gnrc_tcp_rcvbuf.h"
 #include "include/gnrc_tcp_fsm.h"
 
+#ifdef MODULE_GNRC_TCP_CC
+#include "include/gnrc_tcp_cc.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
@@ -64,24 +69,20 @@ static int _is_local_port_in_use(const uint16_t port_number)
 }
 
 /**
- * @brief Generate random unused local port above the well-known ports (> 1024).
+ * @brief Checks if a port picked by the port allocator is used by a TCB.
  *
- * @returns   Generated port number.
+ * @note Called from gnrc_port_alloc_get() with the TCB list locked.
  */
-static uint16_t _get_random_local_port(void)
+static bool _port_in_use(uint16_t port)
 {
-    TCP_DEBUG_ENTER;
-    uint16_t ret = 0;
-    do {
-        ret = random_uint32();
-        if (ret < 1024) {
-            continue;
-        }
-    } while(_is_local_port_in_use(ret));
-    TCP_DEBUG_LEAVE;
-    return ret;
+    return _is_local_port_in_use(port);
 }
 
+/**
+ * @brief Ephemeral ports used by TCBs.
+ */
+static gnrc_port_alloc_t _ports = GNRC_PORT_ALLOC_INIT(_port_in_use);
+
 /**
  * @brief Clears retransmit queue.
  *
@@ -94,7 +95,17 @@ static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_ENTER;
     if (tcb->pkt_retransmit != NULL) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+#ifdef MODULE_GNRC_TCP_CC
+        for (unsigned i = 0; i < tcb->queue_len; i++) {
+            gnrc_pktbuf_release(tcb->pkt_queue[i]);
+        }
+        tcb->queue_len = 0;
+#ifdef MODULE_GNRC_TCP_SACK
+        tcb->sacked = 0;
+#endif
+#else
         gnrc_pktbuf_release(tcb->pkt_retransmit);
+#endif
         tcb->pkt_retransmit = NULL;
     }
     TCP_DEBUG_LEAVE;
@@ -144,6 +155,12 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             LL_DELETE(list->head, tcb);
             mutex_unlock(&list->lock);
 
+            /* Release local port */
+            if (tcb->status & STATUS_PORT_ALLOC) {
+                gnrc_port_alloc_release(&_ports, tcb->local_port);
+                tcb->status &= ~STATUS_PORT_ALLOC;
+            }
+
             /* Free potentially allocated receive buffer */
             _gnrc_tcp_rcvbuf_release_buffer(tcb);
             tcb->status |= STATUS_NOTIFY_USER;
@@ -165,6 +182,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
             if (iter == NULL) {
+                /* Keep listening port from being allocated */
+                if (gnrc_port_alloc_reserve(&_ports, tcb->local_port)) {
+                    tcb->status |= STATUS_PORT_ALLOC;
+                }
                 LL_PREPEND(list->head, tcb);
             }
             mutex_unlock(&list->lock);
@@ -185,18 +206,33 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                         TCP_DEBUG_LEAVE;
                         return -EADDRINUSE;
                     }
+                    if (gnrc_port_alloc_reserve(&_ports, tcb->local_port)) {
+                        tcb->status |= STATUS_PORT_ALLOC;
+                    }
                 }
                 /* Pick random port */
                 else {
-                    tcb->local_port = _get_random_local_port();
+                    tcb->local_port = gnrc_port_alloc_get(&_ports);
+                    if (tcb->local_port == GNRC_PORT_ALLOC_ERR) {
+                        mutex_unlock(&list->lock);
+                        TCP_DEBUG_ERROR("-EADDRINUSE: No free port.")
+                        TCP_DEBUG_LEAVE;
+                        return -EADDRINUSE;
+                    }
+                    tcb->status |= STATUS_PORT_ALLOC;
                 }
                 LL_PREPEND(list->head, tcb);
             }
             mutex_unlock(&list->lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+#ifdef MODULE_GNRC_TCP_CC
+            /* The peers MSS is known now */
+            _gnrc_tcp_cc_init(tcb);
+#endif
+            /* fall-through */
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -274,10 +310,47 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
  *
  * @returns   Number of successfully transmitted bytes.
+ *            -ENOMEM if no segment could be allocated and nothing is in flight
+ *            (only with module `gnrc_tcp_cc`).
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
+#ifdef MODULE_GNRC_TCP_CC
+    size_t sent = 0;
+
+    /* Send segments while the windows are open, keep one queue entry for the FIN */
+    while (sent < len && tcb->queue_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1) {
+        size_t payload = _gnrc_tcp_cc_get_send_window(tcb);
+
+        /* Calculate segment size */
+        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
+        payload = (payload < tcb->mss) ? payload : tcb->mss;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+        if (payload == 0) {
+            break;
+        }
+
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        int res = _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                      tcb->snd_nxt, tcb->rcv_nxt,
+                                      (uint8_t *)buf + sent, payload);
+        if (res < 0) {
+            /* Wait for the packet buffer to be freed by acknowledgments */
+            if (sent == 0 && tcb->pkt_retransmit == NULL) {
+                TCP_DEBUG_LEAVE;
+                return res;
+            }
+            break;
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        sent += payload;
+    }
+    TCP_DEBUG_LEAVE;
+    return sent;
+#else
     size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
 
     /* Check if window is open and all packets were transmitted */
@@ -299,6 +372,7 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     }
     TCP_DEBUG_LEAVE;
     return 0;
+#endif
 }
 
 /**
@@ -673,8 +747,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+#ifdef MODULE_GNRC_TCP_CC
+                    uint32_t acked = seg_ack - tcb->snd_una;
+#endif
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+#ifdef MODULE_GNRC_TCP_CC
+                    _gnrc_tcp_cc_ack(tcb, acked);
+#endif
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -684,6 +764,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     TCP_DEBUG_LEAVE;
                     return 0;
                 }
+#ifdef MODULE_GNRC_TCP_CC
+                /* Duplicate ACK: no data, no window update (see RFC 5681, section 2) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && seg_wnd == tcb->snd_wnd) {
+                    _gnrc_tcp_cc_dupack(tcb);
+                }
+#endif
                 /* Update receive window */
                 if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
@@ -819,6 +906,9 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->pkt_retransmit != NULL) {
+#ifdef MODULE_GNRC_TCP_CC
+        _gnrc_tcp_cc_timeout(tcb);
+#endif
         _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
         _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
     }
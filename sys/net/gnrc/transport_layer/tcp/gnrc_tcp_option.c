@@ -18,6 +18,7 @@
  */
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -32,6 +33,13 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
         return 0;
     }
 
+#ifdef MODULE_GNRC_TCP_SACK
+    /* SACK is only permitted if the peer's SYN contains the option */
+    if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+        tcb->status &= ~STATUS_SACK_PERMITTED;
+    }
+#endif
+
     /* Get pointer to option field and field size */
     uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
     uint8_t opt_left = (offset - TCP_HDR_OFFSET_MIN) * 4;
@@ -64,6 +72,41 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+#ifdef MODULE_GNRC_TCP_SACK
+            case TCP_OPTION_KIND_SACK_PERMITTED:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERMITTED) {
+                    TCP_DEBUG_ERROR("Invalid SACK-permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK-permitted option found.");
+                if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                /* Only use SACK blocks if we permitted them */
+                if (tcb->status & STATUS_SACK_PERMITTED) {
+                    for (uint8_t *block = option->value;
+                         block < (uint8_t *) option + option->length;
+                         block += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        _gnrc_tcp_pkt_sack(tcb, byteorder_bebuftohl(block),
+                                           byteorder_bebuftohl(block + 4));
+                    }
+                }
+                break;
+#endif
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -49,6 +49,83 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the retransmission timeout from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Performs boundary checks on the current RTO and starts the
+ *        retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+/**
+ * @brief Updates the RTT estimation with a new sample.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     rtt   Measured round trip time in milliseconds.
+ */
+static void _update_rtt(gnrc_tcp_tcb_t *tcb, const int32_t rtt)
+{
+    /* If this is the first sample taken */
+    if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->srtt = rtt;
+        tcb->rtt_var = (rtt >> 1);
+    }
+    /* If this is a subsequent sample */
+    else {
+        tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+        tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+        tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+        tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+    }
+}
+
+#ifdef MODULE_GNRC_TCP_CC
+/**
+ * @brief Calculates the sequence number following a packet.
+ *
+ * @param[in] pkt   Packet to calculate the end of.
+ *
+ * @returns   Sequence number of the first octet after @p pkt.
+ */
+static uint32_t _get_seq_end(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
+
+    return byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(pkt);
+}
+#endif
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -181,6 +258,15 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (ctl & MSK_SYN) {
         offset += 1;
     }
+#ifdef MODULE_GNRC_TCP_SACK
+    /* Add SACK-permitted option if SYN is sent, and to SYN+ACK only if the
+     * peer permitted SACK */
+    bool sack_permitted = (ctl & MSK_SYN) &&
+                          (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED));
+    if (sack_permitted) {
+        offset += 1;
+    }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,9 +303,21 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+                opt_left -= sizeof(mss_option);
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
+#ifdef MODULE_GNRC_TCP_SACK
+            if (sack_permitted) {
+                network_uint32_t sack_permitted_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_permitted());
+
+                memcpy(opt_ptr, &sack_permitted_option, sizeof(sack_permitted_option));
+                opt_ptr += sizeof(sack_permitted_option);
+                opt_left -= sizeof(sack_permitted_option);
+            }
+#endif
         }
         *(out_pkt) = tcp_snp;
     }
@@ -287,12 +385,26 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
+#ifdef MODULE_GNRC_TCP_CC
+        tcb->snd_nxt += seq_con;
+        /* Time only one segment at once, as earlier ones may still be in flight */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_TIMING)) {
+            tcb->status |= STATUS_RTT_TIMING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = evtimer_now_msec();
+        }
+#else
         tcb->retries = 0;
         tcb->snd_nxt += seq_con;
         tcb->rtt_start = evtimer_now_msec();
+#endif
     }
     else {
         tcb->retries += 1;
+#ifdef MODULE_GNRC_TCP_CC
+        /* The ACK can't be matched to a transmission anymore (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_TIMING;
+#endif
     }
 
     /* Pass packet down the network stack */
@@ -391,7 +503,11 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Check if retransmit queue is full and pkt is not already in retransmit queue */
+#ifdef MODULE_GNRC_TCP_CC
+    if (!retransmit && tcb->queue_len >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+#else
     if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+#endif
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -409,19 +525,26 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Assign pkt and increase users: every send attempt consumes a user */
+#ifdef MODULE_GNRC_TCP_CC
+    gnrc_pktbuf_hold(pkt, 1);
+    if (!retransmit) {
+        tcb->pkt_queue[tcb->queue_len++] = pkt;
+        tcb->pkt_retransmit = tcb->pkt_queue[0];
+
+        /* The timer is already running for the oldest packet */
+        if (tcb->queue_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+    }
+#else
     tcb->pkt_retransmit = pkt;
     gnrc_pktbuf_hold(pkt, 1);
+#endif
 
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+        _calc_rto(tcb);
     }
     else {
         /* If this is a retransmission: Double the rto (Timer Backoff) */
@@ -435,27 +558,46 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         }
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    _sched_rto(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+#ifdef MODULE_GNRC_TCP_CC
+int _gnrc_tcp_pkt_resend(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(pkt, 1);
+    int res = _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+    TCP_DEBUG_LEAVE;
+    return res;
+}
+#endif
+
+#ifdef MODULE_GNRC_TCP_SACK
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left,
+                        const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->queue_len; i++) {
+        gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(tcb->pkt_queue[i],
+                                                       GNRC_NETTYPE_TCP);
+        uint32_t seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+
+        /* Only packets received completely by the peer are marked */
+        if (LEQ_32_BIT(left, seq) &&
+            LEQ_32_BIT(_get_seq_end(tcb->pkt_queue[i]), right)) {
+            tcb->sacked |= (1UL << i);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
     if (tcb->pkt_retransmit == NULL) {
@@ -464,11 +606,49 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+#ifdef MODULE_GNRC_TCP_CC
+    unsigned acked = 0;
+
+    /* Release all packets that were acknowledged completely */
+    while (acked < tcb->queue_len &&
+           LEQ_32_BIT(_get_seq_end(tcb->pkt_queue[acked]), ack)) {
+        gnrc_pktbuf_release(tcb->pkt_queue[acked]);
+        acked++;
+    }
+
+    if (acked > 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        tcb->queue_len -= acked;
+        memmove(tcb->pkt_queue, &tcb->pkt_queue[acked],
+                tcb->queue_len * sizeof(tcb->pkt_queue[0]));
+#ifdef MODULE_GNRC_TCP_SACK
+        tcb->sacked >>= acked;
+#endif
+        tcb->pkt_retransmit = (tcb->queue_len > 0) ? tcb->pkt_queue[0] : NULL;
+        tcb->retries = 0;
+
+        /* Restart the timer for the remaining packets (see RFC 6298, 5.3) */
+        if (tcb->queue_len > 0) {
+            _calc_rto(tcb);
+            _sched_rto(tcb);
+        }
+    }
+
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_TIMING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
+        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
+
+        tcb->status &= ~STATUS_RTT_TIMING;
+        if (rtt > 0) {
+            _update_rtt(tcb, rtt);
+        }
+    }
+#else
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
 
     /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+    uint32_t seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
         tcb->pkt_retransmit) - 1;
 
         /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
@@ -482,20 +662,10 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 
         /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
         if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+            _update_rtt(tcb, rtt);
         }
     }
+#endif
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP congestion control declarations.
+ *
+ * With module `gnrc_tcp_cc`, up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+ * unacknowledged segments are kept in flight, instead of waiting for the
+ * acknowledgment of every segment. The amount of data in flight is limited
+ * by the congestion window, managed as described in RFC 5681 (slow start,
+ * congestion avoidance, fast retransmit and fast recovery) with the partial
+ * acknowledgment handling of RFC 6582.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_TCP_CC_H
+#define GNRC_TCP_CC_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes congestion control state of a newly established connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Calculates the amount of new data that may be sent.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that fit into the send and congestion window.
+ */
+uint32_t _gnrc_tcp_cc_get_send_window(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates congestion control state after new data was acknowledged.
+ *
+ * @pre Acknowledged packets were removed from the retransmission queue.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+void _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+/**
+ * @brief Updates congestion control state after a duplicate ACK was received.
+ *
+ * Triggers a fast retransmit after @ref CONFIG_GNRC_TCP_DUPACK_THRESHOLD
+ * duplicate ACKs.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_dupack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates congestion control state after the retransmission timer expired.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CC_H */
+/** @} */
@@ -45,6 +45,11 @@ extern "C" {
 #define STATUS_PASSIVE        (1 << 0)
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
+#define STATUS_RTT_TIMING     (1 << 3)  /**< A segment is timed for RTT estimation */
+#define STATUS_FAST_RECOVERY  (1 << 4)  /**< Recovering after a fast retransmit */
+#define STATUS_LOSS_RECOVERY  (1 << 5)  /**< Recovering after a retransmission timeout */
+#define STATUS_SACK_PERMITTED (1 << 6)  /**< Peer sent SACK-permitted option */
+#define STATUS_PORT_ALLOC     (1 << 7)  /**< Local port needs to be released */
 /** @} */
 
 /**
@@ -99,7 +104,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0)
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0)
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y))
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y))
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y))
 /** @} */
 
 /**
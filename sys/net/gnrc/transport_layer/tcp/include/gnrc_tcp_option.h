@@ -42,6 +42,21 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK-permitted option.
+ *
+ * The option is padded with two leading NOPs to a multiple of four bytes.
+ *
+ * @returns   SACK-permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_permitted(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERMITTED << 8) |
+            TCP_OPTION_LENGTH_SACK_PERMITTED);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -133,6 +133,33 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+#if defined(MODULE_GNRC_TCP_CC) || defined(DOXYGEN)
+/**
+ * @brief Retransmits a packet from the retransmission queue.
+ *
+ * @note Unlike a retransmission after a timeout, the retransmission timer
+ *       is left untouched.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Packet in the retransmission queue.
+ *
+ * @returns   Zero on success.
+ */
+int _gnrc_tcp_pkt_resend(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+#endif
+
+#if defined(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+/**
+ * @brief Marks packets selectively acknowledged by the peer.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left,
+                        const uint32_t right);
+#endif
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
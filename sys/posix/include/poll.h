@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_poll     POSIX poll
+ * @ingroup  posix
+ * @brief   Poll and epoll implementation for RIOT
+ *
+ * `poll()` examines a set of file descriptors like @ref posix_select, but
+ * without the limitation to @ref CONFIG_POSIX_FD_SET_SIZE. For applications
+ * multiplexing many file descriptors, `<sys/epoll.h>` provides a registered
+ * interest set: sockets notify the epoll instance on reception, so
+ * `epoll_wait()` only needs to look at the sockets that became ready instead
+ * of scanning all of them.
+ *
+ * @see     [The Open Group Base Specification Issue 7]
+ *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ * @todo    Omitted from original specification for now:
+ *          - `POLLPRI`, `POLLRDBAND` and `POLLWRBAND` are never reported
+ *          - `POLLERR` and `POLLHUP` are never reported
+ * @todo    Currently, only [sockets](@ref posix_sockets) are supported
+ * @{
+ *
+ * @file
+ * @brief   Poll definitions
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <poll.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/poll.h)
+ *
+ * @author  agent <agent@local>
+ */
+
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   @ref core_thread_flags for POSIX poll and epoll
+ */
+#define POSIX_POLL_THREAD_FLAG  (1U << 4)
+
+/**
+ * @name    Poll event flags
+ *
+ * @note    Values match the ones of Linux, so `struct pollfd` can be used
+ *          with the host's `poll()` on `native`.
+ * @{
+ */
+#define POLLIN      (0x001)     /**< Data other than high-priority data may
+                                 *   be read without blocking */
+#define POLLPRI     (0x002)     /**< High-priority data may be read without
+                                 *   blocking */
+#define POLLOUT     (0x004)     /**< Normal data may be written without
+                                 *   blocking */
+#define POLLERR     (0x008)     /**< An error has occurred (`revents` only) */
+#define POLLHUP     (0x010)     /**< Device has been disconnected (`revents`
+                                 *   only) */
+#define POLLNVAL    (0x020)     /**< Invalid `fd` member (`revents` only) */
+#define POLLRDNORM  (0x040)     /**< Normal data may be read without
+                                 *   blocking */
+#define POLLRDBAND  (0x080)     /**< Priority data may be read without
+                                 *   blocking */
+#define POLLWRNORM  (0x100)     /**< Equivalent to @ref POLLOUT */
+#define POLLWRBAND  (0x200)     /**< Priority data may be written */
+/** @} */
+
+/**
+ * @brief   Type used for the number of file descriptors
+ */
+typedef unsigned long nfds_t;
+
+/**
+ * @brief   A file descriptor to examine with @ref poll()
+ */
+struct pollfd {
+    int fd;         /**< The file descriptor being polled. Negative values
+                     *   are ignored */
+    short events;   /**< The input event flags */
+    short revents;  /**< The output event flags */
+};
+
+/**
+ * @brief   Examines the given file descriptors if they are ready for the
+ *          requested events
+ *
+ * @param[in,out] fds   The file descriptors to examine. The `revents` member
+ *                      is set to the events that occurred for each of them.
+ * @param[in] nfds      Number of elements in @p fds.
+ * @param[in] timeout   Timeout in milliseconds to block until one or more
+ *                      of the file descriptors is ready. Set to 0 to return
+ *                      immediately without blocking. Set to -1 to block
+ *                      indefinitely.
+ *
+ * @return  number of members of @p fds with a non-zero `revents` member on
+ *          success.
+ * @return  0 if @p timeout expired.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int poll(struct pollfd *fds, nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+/** @} */
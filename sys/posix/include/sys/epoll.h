@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  posix_poll
+ * @{
+ *
+ * @file
+ * @brief   epoll-style readiness notification
+ *
+ * Other than `poll()`, the file descriptors are registered once with
+ * `epoll_ctl()`. Sockets mark their registration ready when data is
+ * received, so `epoll_wait()` only examines ready file descriptors,
+ * independent of the number of registered ones.
+ *
+ * Only level-triggered notification is supported, i.e. a file descriptor is
+ * reported by every call to `epoll_wait()` as long as it is ready.
+ *
+ * @note    A socket can only be registered with one epoll instance at a time.
+ *
+ * @see     [epoll(7)](https://man7.org/linux/man-pages/man7/epoll.7.html)
+ *
+ * @author  agent <agent@local>
+ */
+
+#ifndef SYS_EPOLL_H
+#define SYS_EPOLL_H
+
+#include <stdint.h>
+
+#include "poll.h"
+#include "sys/select.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup  config_posix
+ * @{
+ */
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_NUMOF
+#define CONFIG_POSIX_EPOLL_NUMOF    (1)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors registered with one epoll
+ *          instance
+ */
+#ifndef CONFIG_POSIX_EPOLL_MAX_FDS
+#define CONFIG_POSIX_EPOLL_MAX_FDS  (CONFIG_POSIX_FD_SET_SIZE)
+#endif
+/** @} */
+
+/**
+ * @name    epoll event flags
+ * @{
+ */
+#define EPOLLIN         (POLLIN)        /**< Data is available for reading */
+#define EPOLLPRI        (POLLPRI)       /**< Urgent data is available for
+                                         *   reading (never reported) */
+#define EPOLLOUT        (POLLOUT)       /**< Data may be written */
+#define EPOLLERR        (POLLERR)       /**< Error condition (never
+                                         *   reported) */
+#define EPOLLHUP        (POLLHUP)       /**< Hang up (never reported) */
+#define EPOLLRDNORM     (POLLRDNORM)    /**< Equivalent to @ref EPOLLIN */
+#define EPOLLWRNORM     (POLLWRNORM)    /**< Equivalent to @ref EPOLLOUT */
+#define EPOLLRDHUP      (0x2000)        /**< Peer closed connection (never
+                                         *   reported) */
+#define EPOLLONESHOT    (1U << 30)      /**< One-shot notification
+                                         *   (**not supported**) */
+#define EPOLLET         (1U << 31)      /**< Edge-triggered notification
+                                         *   (**not supported**) */
+/** @} */
+
+/**
+ * @name    Operations for epoll_ctl()
+ * @{
+ */
+#define EPOLL_CTL_ADD   (1)     /**< Register a file descriptor */
+#define EPOLL_CTL_DEL   (2)     /**< Deregister a file descriptor */
+#define EPOLL_CTL_MOD   (3)     /**< Change the events of a registered file
+                                 *   descriptor */
+/** @} */
+
+/**
+ * @brief   Flag for epoll_create1(). Accepted for compatibility, but without
+ *          effect.
+ */
+#define EPOLL_CLOEXEC   (1U << 19)
+
+/**
+ * @brief   User data of an epoll event
+ */
+typedef union epoll_data {
+    void *ptr;      /**< pointer */
+    int fd;         /**< file descriptor */
+    uint32_t u32;   /**< 32-bit value */
+    uint64_t u64;   /**< 64-bit value */
+} epoll_data_t;
+
+/**
+ * @brief   An epoll event
+ */
+struct epoll_event {
+    uint32_t events;    /**< epoll event flags */
+    epoll_data_t data;  /**< user data */
+};
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] flags Flags for the instance. Must be 0 or @ref EPOLL_CLOEXEC.
+ *
+ * @return  file descriptor of the new instance on success. Close it with
+ *          `close()`.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] size  Ignored but must be greater than zero.
+ *
+ * @return  file descriptor of the new instance on success. Close it with
+ *          `close()`.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Adds, modifies, or removes a file descriptor of an epoll instance
+ *
+ * @param[in] epfd  An epoll instance.
+ * @param[in] op    One of @ref EPOLL_CTL_ADD, @ref EPOLL_CTL_MOD, or
+ *                  @ref EPOLL_CTL_DEL.
+ * @param[in] fd    The target file descriptor. Must be a socket.
+ * @param[in] event The events to wait for and the user data to report with
+ *                  them. May be NULL for @ref EPOLL_CTL_DEL.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits for events on an epoll instance
+ *
+ * @param[in] epfd      An epoll instance.
+ * @param[out] events   The events that occurred.
+ * @param[in] maxevents Maximum number of events to return in @p events.
+ * @param[in] timeout   Timeout in milliseconds to block until an event
+ *                      occurs. Set to 0 to return immediately without
+ *                      blocking. Set to -1 to block indefinitely.
+ *
+ * @return  number of events in @p events on success.
+ * @return  0 if @p timeout expired.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_EPOLL_H */
+/** @} */
@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <sys/epoll.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#include "posix_poll_internal.h"
+
+#define EPOLL_UNSUPPORTED   (EPOLLONESHOT | EPOLLET)
+
+typedef struct _epoll _epoll_t;
+
+/**
+ * @brief   A file descriptor registered with an epoll instance
+ */
+typedef struct {
+    clist_node_t ready_node;    /**< node in _epoll_t::ready */
+    _epoll_t *ep;               /**< the epoll instance */
+    struct epoll_event event;   /**< the registered events */
+    int fd;                     /**< the file descriptor, -1 if unused */
+    bool ready;                 /**< item is in _epoll_t::ready */
+} _epoll_item_t;
+
+/**
+ * @brief   An epoll instance
+ */
+struct _epoll {
+    _epoll_item_t items[CONFIG_POSIX_EPOLL_MAX_FDS];  /**< interest set */
+    clist_node_t ready;         /**< items that may be ready */
+    thread_t *waiting;          /**< thread waiting in epoll_wait() */
+    bool used;                  /**< instance is in use */
+};
+
+static int _epoll_close(vfs_file_t *filp);
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+static _epoll_t _epoll_pool[CONFIG_POSIX_EPOLL_NUMOF];
+static mutex_t _epoll_pool_mutex = MUTEX_INIT;
+
+static _epoll_t *_get_epoll(int epfd)
+{
+    const vfs_file_t *filp = vfs_file_get(epfd);
+
+    if ((filp == NULL) || (filp->f_op != &_epoll_ops)) {
+        return NULL;
+    }
+    return filp->private_data.ptr;
+}
+
+static _epoll_item_t *_get_item(_epoll_t *ep, int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        if (ep->items[i].fd == fd) {
+            return &ep->items[i];
+        }
+    }
+    return NULL;
+}
+
+/* call with interrupts disabled */
+static void _set_ready(_epoll_item_t *item)
+{
+    if (!item->ready) {
+        item->ready = true;
+        clist_rpush(&item->ep->ready, &item->ready_node);
+    }
+}
+
+/* call with interrupts disabled */
+static void _remove(_epoll_item_t *item)
+{
+    if (item->ready) {
+        clist_remove(&item->ep->ready, &item->ready_node);
+        item->ready = false;
+    }
+    item->fd = -1;
+}
+
+static void _notify(int fd, bool closed, void *arg)
+{
+    _epoll_item_t *item = arg;
+    unsigned state = irq_disable();
+
+    if (item->fd == fd) {
+        if (closed) {
+            /* closed file descriptors are removed implicitly */
+            _remove(item);
+        }
+        else {
+            _set_ready(item);
+            if (item->ep->waiting != NULL) {
+                thread_flags_set(item->ep->waiting, POSIX_POLL_THREAD_FLAG);
+            }
+        }
+    }
+    irq_restore(state);
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    _epoll_t *ep = filp->private_data.ptr;
+
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        int fd = ep->items[i].fd;
+
+        if (fd >= 0) {
+            unsigned state;
+
+            posix_socket_notify(fd, NULL, NULL);
+            state = irq_disable();
+            _remove(&ep->items[i]);
+            irq_restore(state);
+        }
+    }
+    mutex_lock(&_epoll_pool_mutex);
+    ep->used = false;
+    mutex_unlock(&_epoll_pool_mutex);
+    return 0;
+}
+
+int epoll_create1(int flags)
+{
+    _epoll_t *ep = NULL;
+    int res;
+
+    if (flags & ~EPOLL_CLOEXEC) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_epoll_pool_mutex);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        if (!_epoll_pool[i].used) {
+            ep = &_epoll_pool[i];
+            break;
+        }
+    }
+    if (ep == NULL) {
+        mutex_unlock(&_epoll_pool_mutex);
+        errno = ENFILE;
+        return -1;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_MAX_FDS; i++) {
+        ep->items[i].fd = -1;
+        ep->items[i].ep = ep;
+        ep->items[i].ready = false;
+    }
+    ep->ready.next = NULL;
+    ep->waiting = NULL;
+    if ((res = vfs_bind(VFS_ANY_FD, O_RDONLY, &_epoll_ops, ep)) < 0) {
+        errno = -res;
+        res = -1;
+    }
+    else {
+        ep->used = true;
+    }
+    mutex_unlock(&_epoll_pool_mutex);
+    return res;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    _epoll_t *ep = _get_epoll(epfd);
+    _epoll_item_t *item;
+    unsigned state;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if (!posix_socket_is(fd)) {
+        errno = EPERM;
+        return -1;
+    }
+    if ((op != EPOLL_CTL_DEL) &&
+        ((event == NULL) || (event->events & EPOLL_UNSUPPORTED))) {
+        errno = EINVAL;
+        return -1;
+    }
+    item = _get_item(ep, fd);
+    switch (op) {
+        case EPOLL_CTL_ADD:
+            if (item != NULL) {
+                errno = EEXIST;
+                return -1;
+            }
+            if ((item = _get_item(ep, -1)) == NULL) {
+                errno = ENOSPC;
+                return -1;
+            }
+            item->event = *event;
+            item->fd = fd;
+            if (posix_socket_notify(fd, _notify, item) < 0) {
+                item->fd = -1;
+                return -1;
+            }
+            break;
+        case EPOLL_CTL_MOD:
+            if (item == NULL) {
+                errno = ENOENT;
+                return -1;
+            }
+            state = irq_disable();
+            item->event = *event;
+            irq_restore(state);
+            break;
+        case EPOLL_CTL_DEL:
+            if (item == NULL) {
+                errno = ENOENT;
+                return -1;
+            }
+            posix_socket_notify(fd, NULL, NULL);
+            state = irq_disable();
+            _remove(item);
+            irq_restore(state);
+            return 0;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+    /* data may have been received before registration or the new events
+     * may already be ready, so have epoll_wait() check it */
+    state = irq_disable();
+    _set_ready(item);
+    irq_restore(state);
+    if (ep->waiting != NULL) {
+        thread_flags_set(ep->waiting, POSIX_POLL_THREAD_FLAG);
+    }
+    return 0;
+}
+
+static int _collect(_epoll_t *ep, struct epoll_event *events, int maxevents)
+{
+    unsigned state = irq_disable();
+    /* items that stay ready are re-appended, so only check each once */
+    size_t pending = clist_count(&ep->ready);
+    int res = 0;
+
+    irq_restore(state);
+    while ((pending-- > 0) && (res < maxevents)) {
+        clist_node_t *node;
+        _epoll_item_t *item;
+        struct epoll_event event;
+        uint32_t revents;
+        int fd;
+
+        state = irq_disable();
+        if ((node = clist_lpop(&ep->ready)) == NULL) {
+            irq_restore(state);
+            break;
+        }
+        item = container_of(node, _epoll_item_t, ready_node);
+        item->ready = false;
+        fd = item->fd;
+        event = item->event;
+        irq_restore(state);
+
+        revents = posix_poll_revents(fd, event.events);
+        if (revents) {
+            events[res].events = revents;
+            events[res].data = event.data;
+            res++;
+            /* level-triggered: report again on the next call, unless it was
+             * removed or changed in the meantime */
+            state = irq_disable();
+            if (item->fd == fd) {
+                _set_ready(item);
+            }
+            irq_restore(state);
+        }
+    }
+    return res;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    uint32_t start = xtimer_now_usec();
+    _epoll_t *ep = _get_epoll(epfd);
+    xtimer_t timeout_timer;
+    int res;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((events == NULL) || (maxevents <= 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    assert(ep->waiting == NULL);
+    ep->waiting = thread_get_active();
+    /* clear before collecting, so no notification is missed in between */
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG);
+    while (((res = _collect(ep, events, maxevents)) == 0) && (timeout != 0)) {
+        if (!posix_poll_wait(&timeout_timer, start, timeout)) {
+            break;
+        }
+    }
+    ep->waiting = NULL;
+    return res;
+}
+
+/** @} */
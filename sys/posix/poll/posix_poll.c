@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+
+#include "thread_flags.h"
+#include "xtimer.h"
+
+#include "posix_poll_internal.h"
+
+bool posix_poll_wait(xtimer_t *timer, uint32_t start, int timeout)
+{
+    thread_flags_t tflags;
+
+    if (timeout < 0) {
+        return thread_flags_wait_any(POSIX_POLL_THREAD_FLAG) != 0;
+    }
+    else {
+        uint64_t t = (uint64_t)timeout * US_PER_MS;
+        uint32_t elapsed = xtimer_now_usec() - start;
+
+        if (elapsed >= t) {
+            return false;
+        }
+        xtimer_set_timeout_flag64(timer, t - elapsed);
+    }
+    tflags = thread_flags_wait_any(POSIX_POLL_THREAD_FLAG |
+                                   THREAD_FLAG_TIMEOUT);
+    xtimer_remove(timer);
+    /* timer may have fired after we were woken up by a socket */
+    thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    return (tflags & POSIX_POLL_THREAD_FLAG);
+}
+
+static int _scan(struct pollfd *fds, nfds_t nfds)
+{
+    int res = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        fds[i].revents = 0;
+        if (fds[i].fd < 0) {
+            continue;
+        }
+        if (!posix_socket_is(fds[i].fd)) {
+            fds[i].revents = POLLNVAL;
+        }
+        else {
+            fds[i].revents = posix_poll_revents(fds[i].fd, fds[i].events);
+        }
+        if (fds[i].revents) {
+            res++;
+        }
+    }
+    return res;
+}
+
+int poll(struct pollfd *fds, nfds_t nfds, int timeout)
+{
+    uint32_t start = xtimer_now_usec();
+    xtimer_t timeout_timer;
+    int res;
+
+    if ((fds == NULL) && (nfds > 0)) {
+        errno = EFAULT;
+        return -1;
+    }
+    /* register before the first scan, so no reception is missed in
+     * between */
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG);
+    for (nfds_t i = 0; i < nfds; i++) {
+        if ((fds[i].fd >= 0) && posix_socket_is(fds[i].fd) &&
+            (posix_socket_poll(fds[i].fd) < 0)) {
+            return -1;
+        }
+    }
+    while (((res = _scan(fds, nfds)) == 0) && (timeout != 0)) {
+        if (!posix_poll_wait(&timeout_timer, start, timeout)) {
+            break;
+        }
+    }
+    return res;
+}
+
+/** @} */
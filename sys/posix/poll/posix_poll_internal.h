@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup posix_poll
+ * @{
+ *
+ * @file
+ * @brief   Definitions shared by poll() and epoll
+ * @internal
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef POSIX_POLL_INTERNAL_H
+#define POSIX_POLL_INTERNAL_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "poll.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Callback for readiness notifications of a socket
+ *
+ * @param[in] fd        The socket.
+ * @param[in] closed    true, if @p fd is about to be closed.
+ * @param[in] arg       Argument as provided to posix_socket_notify().
+ */
+typedef void (*posix_poll_notify_cb_t)(int fd, bool closed, void *arg);
+
+#if IS_USED(MODULE_POSIX_SOCKETS) || defined(DOXYGEN)
+/**
+ * @brief   Checks if @p fd is a socket
+ */
+bool posix_socket_is(int fd);
+
+/**
+ * @brief   Number of notifications for received data on socket @p fd not
+ *          yet read
+ */
+unsigned posix_socket_avail(int fd);
+
+/**
+ * @brief   Sets @ref POSIX_POLL_THREAD_FLAG of the calling thread when data
+ *          is received on socket @p fd
+ *
+ * @return  0 on success.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int posix_socket_poll(int fd);
+
+/**
+ * @brief   Calls @p cb when data is received on socket @p fd or @p fd is
+ *          closed
+ *
+ * There is only one callback per socket. Set @p cb to NULL to remove it.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, `errno` is set to indicate the error. `EBUSY`, if
+ *          another callback is already set for @p fd.
+ */
+int posix_socket_notify(int fd, posix_poll_notify_cb_t cb, void *arg);
+#else   /* MODULE_POSIX_SOCKETS */
+static inline bool posix_socket_is(int fd)
+{
+    (void)fd;
+    return false;
+}
+
+static inline unsigned posix_socket_avail(int fd)
+{
+    (void)fd;
+    return 0;
+}
+
+static inline int posix_socket_poll(int fd)
+{
+    (void)fd;
+    errno = ENOTSUP;
+    return -1;
+}
+
+static inline int posix_socket_notify(int fd, posix_poll_notify_cb_t cb,
+                                      void *arg)
+{
+    (void)fd;
+    (void)cb;
+    (void)arg;
+    errno = ENOTSUP;
+    return -1;
+}
+#endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
+
+/**
+ * @brief   Gets the events of @p events that are currently ready on @p fd
+ *
+ * @param[in] fd        A socket.
+ * @param[in] events    Requested event flags (`POLL*` flags).
+ *
+ * @return  The ready subset of @p events.
+ */
+static inline unsigned posix_poll_revents(int fd, unsigned events)
+{
+    /* sending does not block on the supported sockets */
+    unsigned revents = events & (POLLOUT | POLLWRNORM);
+
+    if ((events & (POLLIN | POLLRDNORM)) && (posix_socket_avail(fd) > 0)) {
+        revents |= events & (POLLIN | POLLRDNORM);
+    }
+    return revents;
+}
+
+/**
+ * @brief   Waits for @ref POSIX_POLL_THREAD_FLAG
+ *
+ * @param[in] timer     Timer for @p timeout.
+ * @param[in] start     Start of the operation in microseconds.
+ * @param[in] timeout   Timeout of the operation in milliseconds since
+ *                      @p start. Negative to wait indefinitely.
+ *
+ * @return  true, if the flag was set.
+ * @return  false, if @p timeout expired.
+ */
+bool posix_poll_wait(xtimer_t *timer, uint32_t start, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POSIX_POLL_INTERNAL_H */
+/** @} */
@@ -44,6 +44,12 @@
 #if IS_USED(MODULE_POSIX_SELECT)
 #include <sys/select.h>
 
+#include "thread.h"
+#include "thread_flags.h"
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+#include <poll.h>
+
 #include "thread.h"
 #include "thread_flags.h"
 #endif
@@ -95,6 +101,11 @@ typedef struct {
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
     thread_t *selecting_thread;
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+    thread_t *polling_thread;
+    void (*notify_cb)(int fd, bool closed, void *arg);
+    void *notify_arg;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
 } socket_t;
@@ -127,6 +138,11 @@ static socket_t *_get_free_socket(void)
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
             _socket_pool[i].selecting_thread = NULL;
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+            _socket_pool[i].polling_thread = NULL;
+            _socket_pool[i].notify_cb = NULL;
+            _socket_pool[i].notify_arg = NULL;
 #endif
             return &_socket_pool[i];
         }
@@ -320,6 +336,12 @@ static int socket_close(vfs_file_t *filp)
         }
     }
     mutex_unlock(&_socket_pool_mutex);
+#if IS_USED(MODULE_POSIX_POLL)
+    if (s->notify_cb) {
+        s->notify_cb(s->fd, true, s->notify_arg);
+        s->notify_cb = NULL;
+    }
+#endif
     s->sock = NULL;
     s->domain = AF_UNSPEC;
     return res;
@@ -375,6 +397,14 @@ static void _async_cb(void *sock, sock_async_flags_t type,
             thread_flags_set(socket->selecting_thread,
                              POSIX_SELECT_THREAD_FLAG);
         }
+#endif
+#if IS_USED(MODULE_POSIX_POLL)
+        if (socket->polling_thread) {
+            thread_flags_set(socket->polling_thread, POSIX_POLL_THREAD_FLAG);
+        }
+        if (socket->notify_cb) {
+            socket->notify_cb(socket->fd, false, socket->notify_arg);
+        }
 #endif
     }
 }
@@ -974,10 +1004,18 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
             res = -EOPNOTSUPP;
             break;
     }
-    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
 #ifdef MODULE_SOCK_ASYNC
-        atomic_fetch_sub(&s->available, 1);
+    if (res >= 0) {
+        unsigned available = atomic_load(&s->available);
+
+        /* don't wrap around, a stream socket may be read more often than it
+         * was notified about received data */
+        while ((available > 0) &&
+               !atomic_compare_exchange_weak(&s->available, &available,
+                                             available - 1)) {}
+    }
 #endif
+    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
             case SOCK_STREAM:
@@ -1207,6 +1245,76 @@ int posix_socket_select(int fd)
     return -1;
 }
 
+#if IS_USED(MODULE_POSIX_POLL)
+static socket_t *_get_watchable_socket(int fd)
+{
+    socket_t *socket = _get_socket(fd);
+
+    if (socket == NULL) {
+        errno = ENOTSOCK;
+        return NULL;
+    }
+    if (socket->sock == NULL) {  /* socket is not connected */
+        /* bind implicitly */
+        if (_bind_connect(socket, NULL, 0) < 0) {
+            return NULL;
+        }
+    }
+    return socket;
+}
+#endif
+
+int posix_socket_poll(int fd)
+{
+#if IS_USED(MODULE_POSIX_POLL)
+    socket_t *socket = _get_watchable_socket(fd);
+
+    if (socket != NULL) {
+        socket->polling_thread = thread_get_active();
+        return 0;
+    }
+    return -1;
+#else
+    (void)fd;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+int posix_socket_notify(int fd, void (*cb)(int, bool, void *), void *arg)
+{
+#if IS_USED(MODULE_POSIX_POLL)
+    socket_t *socket;
+
+    if (cb == NULL) {
+        /* don't bind implicitly just to remove the callback */
+        if ((socket = _get_socket(fd)) != NULL) {
+            socket->notify_cb = NULL;
+            socket->notify_arg = NULL;
+        }
+        return 0;
+    }
+    if ((socket = _get_watchable_socket(fd)) == NULL) {
+        return -1;
+    }
+    if ((socket->notify_cb != NULL) && ((socket->notify_cb != cb) ||
+                                        (socket->notify_arg != arg))) {
+        errno = EBUSY;
+        return -1;
+    }
+    /* set argument first, callback may be called from the network stack */
+    socket->notify_arg = arg;
+    socket->notify_cb = cb;
+    return 0;
+#else
+    (void)fd;
+    (void)cb;
+    (void)arg;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 /**
  * @}
  */
@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <kernel_defines.h>
 
@@ -29,6 +30,9 @@ static int _nib_route(int argc, char **argv);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static int _nib_abr(int argc, char **argv);
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+static int _nib_cache(int argc, char **argv);
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
 
 int _gnrc_ipv6_nib(int argc, char **argv)
 {
@@ -52,6 +56,11 @@ int _gnrc_ipv6_nib(int argc, char **argv)
         res = _nib_abr(argc, argv);
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+    else if (strcmp(argv[1], "cache") == 0) {
+        res = _nib_cache(argc, argv);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
     else {
         _usage(argv);
     }
@@ -60,11 +69,9 @@ int _gnrc_ipv6_nib(int argc, char **argv)
 
 static void _usage(char **argv)
 {
-#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
-    printf("usage: %s {neigh|prefix|route|abr|help} ...\n", argv[0]);
-#else   /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
-    printf("usage: %s {neigh|prefix|route|help} ...\n", argv[0]);
-#endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+    printf("usage: %s {neigh|prefix|route%s%s|help} ...\n", argv[0],
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C) ? "|abr" : "",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC) ? "|cache" : "");
 }
 
 static void _usage_nib_neigh(char **argv)
@@ -370,4 +377,44 @@ static int _nib_abr(int argc, char **argv)
 }
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+static void _usage_nib_cache(char **argv)
+{
+    printf("usage: %s %s [show|flush|help]\n", argv[0], argv[1]);
+}
+
+static int _nib_cache(int argc, char **argv)
+{
+    if ((argc == 2) || (strcmp(argv[2], "show") == 0)) {
+        gnrc_ipv6_nib_rc_t entry;
+        gnrc_ipv6_nib_rc_stats_t stats;
+        void *state = NULL;
+        uint32_t lookups;
+
+        while (gnrc_ipv6_nib_rc_iter(&state, &entry)) {
+            gnrc_ipv6_nib_rc_print(&entry);
+        }
+        gnrc_ipv6_nib_rc_get_stats(&stats);
+        lookups = stats.hits + stats.misses;
+        printf("hits: %" PRIu32 ", misses: %" PRIu32 " (hit rate: %u%%), "
+               "flushes: %" PRIu32 "\n", stats.hits, stats.misses,
+               (lookups == 0) ? 0U
+                              : (unsigned)(((uint64_t)stats.hits * 100U) /
+                                           lookups),
+               stats.flushes);
+    }
+    else if ((argc > 2) && (strcmp(argv[2], "help") == 0)) {
+        _usage_nib_cache(argv);
+    }
+    else if ((argc > 2) && (strcmp(argv[2], "flush") == 0)) {
+        gnrc_ipv6_nib_rc_flush();
+    }
+    else {
+        _usage_nib_cache(argv);
+        return 1;
+    }
+    return 0;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_RC */
+
 /** @} */
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to dump the binary event trace
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "trace_event.h"
+
+int _trace_event_handler(int argc, char **argv)
+{
+    if ((argc < 2) || (strcmp(argv[1], "dump") == 0)) {
+        trace_event_dump();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        trace_event_reset();
+    }
+    else {
+        printf("usage: %s [dump|reset]\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace_event
+ * @{
+ *
+ * @file
+ * @brief       Binary event trace implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+
+#include "trace_event.h"
+
+#define TRACE_EVENT_FORMAT_VERSION  (2U)
+
+static_assert((CONFIG_TRACE_EVENT_NUMOF & (CONFIG_TRACE_EVENT_NUMOF - 1)) == 0,
+              "CONFIG_TRACE_EVENT_NUMOF must be a power of two");
+static_assert(sizeof(trace_event_t) == 16,
+              "trace_event_t must not contain padding");
+
+static trace_event_t _events[CONFIG_TRACE_EVENT_NUMOF];
+static atomic_uint _writes = ATOMIC_VAR_INIT(0);
+static atomic_bool _paused = ATOMIC_VAR_INIT(false);
+
+static void _add(trace_event_type_t type, int8_t pid, uint32_t arg0,
+                 uint32_t arg1)
+{
+    trace_event_t *event;
+
+    if (atomic_load_explicit(&_paused, memory_order_relaxed)) {
+        return;
+    }
+    /* reserving the slot is the only access shared between writers */
+    event = &_events[atomic_fetch_add_explicit(&_writes, 1,
+                                               memory_order_relaxed) &
+                     (CONFIG_TRACE_EVENT_NUMOF - 1)];
+    event->time = xtimer_now_usec();
+    event->type = type;
+    event->pid = pid;
+    event->reserved = 0;
+    event->arg0 = arg0;
+    event->arg1 = arg1;
+}
+
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+#ifdef MODULE_SCHEDSTATISTICS
+    /* there is only one scheduler callback, so keep schedstatistics working */
+    sched_statistics_cb(active, next);
+#endif
+    _add(TRACE_EVENT_SCHED, active, next, 0);
+}
+
+void trace_event_init(void)
+{
+    if (CONFIG_TRACE_EVENT_MASK & (1UL << TRACE_EVENT_SCHED)) {
+        sched_register_cb(_sched_cb);
+    }
+}
+
+void trace_event_add(trace_event_type_t type, uint32_t arg0, uint32_t arg1)
+{
+    _add(type, irq_is_in() ? TRACE_EVENT_PID_ISR : thread_getpid(), arg0,
+         arg1);
+}
+
+void trace_event_dump(void)
+{
+    unsigned writes, start;
+
+    atomic_store(&_paused, true);
+    writes = atomic_load(&_writes);
+    start = (writes > CONFIG_TRACE_EVENT_NUMOF)
+          ? writes - CONFIG_TRACE_EVENT_NUMOF
+          : 0;
+    printf("trace_event begin version=%u events=%u lost=%u\n",
+           TRACE_EVENT_FORMAT_VERSION, writes - start, start);
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid) != NULL) {
+            const char *name = thread_getname(pid);
+
+            printf("thread %d %s\n", pid, (name) ? name : "-");
+        }
+    }
+    for (unsigned i = start; i != writes; i++) {
+        const uint8_t *event = (const uint8_t *)
+                               &_events[i & (CONFIG_TRACE_EVENT_NUMOF - 1)];
+
+        for (unsigned j = 0; j < sizeof(trace_event_t); j++) {
+            printf("%02x", event[j]);
+        }
+        puts("");
+    }
+    puts("trace_event end");
+    atomic_store(&_paused, false);
+}
+
+void trace_event_reset(void)
+{
+    atomic_store(&_writes, 0);
+}
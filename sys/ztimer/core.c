@@ -18,6 +18,11 @@
  * This file contains ztimer's main API implementation and functionality
  * present in all ztimer clocks (most notably multiplexing ant extension).
  *
+ * Active timers are kept either in a delta-encoded list (default) or, with
+ * the `ztimer_heap` module, in a pairing heap keyed by absolute target. The
+ * heap makes ztimer_set() O(1) and ztimer_remove() O(log n) (amortized),
+ * bounding the time spent with interrupts disabled when many timers are set.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
@@ -38,6 +43,7 @@
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _expire_head(ztimer_clock_t *clock);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 
@@ -48,6 +54,34 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+#if MODULE_ZTIMER_HEAP
+/* The heap links of a timer cannot tell whether it is set: a timer that was
+ * never set may hold anything, and following its links would corrupt the
+ * heap. Instead, a set timer carries a tag that depends on its own address
+ * and the clock's. It is cleared when the timer is removed or fires. */
+static inline uintptr_t _armed_tag(const ztimer_clock_t *clock,
+                                   const ztimer_base_t *entry)
+{
+    return ((uintptr_t)entry ^ (uintptr_t)clock) ^ (uintptr_t)0x5a3c96e1UL;
+}
+
+static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
+{
+    return (t->base.armed == _armed_tag(clock, &t->base));
+}
+
+/* next timer to expire: expired timers first, then the root of the heap */
+static inline ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+    return (clock->expired) ? clock->expired : clock->list.next;
+}
+
+/* ticks from the clock's base until the first timer expires */
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return (clock->expired) ? 0 : clock->list.next->offset - clock->list.offset;
+}
+#else
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
@@ -58,6 +92,17 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
     }
 }
 
+static inline ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+    return clock->list.next;
+}
+
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+    return clock->list.next->offset;
+}
+#endif
+
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     unsigned state = irq_disable();
@@ -94,7 +139,7 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    if (_first(clock) == &timer->base) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -107,6 +152,259 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     irq_restore(state);
 }
 
+static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
+{
+    if (a < b) {
+        a += mod + 1;
+    }
+    return a - b;
+}
+
+#ifdef MODULE_ZTIMER_EXTEND
+ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
+{
+    assert(clock->max_value);
+    unsigned state = irq_disable();
+    uint32_t lower_now = clock->ops->now(clock);
+    DEBUG(
+        "ztimer_now() checkpoint=%" PRIu32 " lower_last=%" PRIu32 " lower_now=%" PRIu32 " diff=%" PRIu32 "\n",
+        (uint32_t)clock->checkpoint, clock->lower_last, lower_now,
+        _add_modulo(lower_now, clock->lower_last, clock->max_value));
+    clock->checkpoint += _add_modulo(lower_now, clock->lower_last,
+                                     clock->max_value);
+    clock->lower_last = lower_now;
+    DEBUG("ztimer_now() returning %" PRIu32 "\n", (uint32_t)clock->checkpoint);
+    ztimer_now_t now = clock->checkpoint;
+    irq_restore(state);
+    return now;
+}
+#endif /* MODULE_ZTIMER_EXTEND */
+
+#if MODULE_ZTIMER_HEAP
+/* Timers in the heap store their absolute target in ztimer_base_t::offset.
+ * Targets are compared relative to the clock's base (clock->list.offset),
+ * which never passes a timer still in the heap: timers that expire while the
+ * base is advanced are moved to the clock's expired list first. */
+static inline int _heap_before(const ztimer_clock_t *clock,
+                               const ztimer_base_t *a, const ztimer_base_t *b)
+{
+    return (a->offset - clock->list.offset) < (b->offset - clock->list.offset);
+}
+
+static ztimer_base_t *_heap_meld(const ztimer_clock_t *clock,
+                                 ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (_heap_before(clock, b, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    /* b becomes the first child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/* standard two-pass pairing of a list of siblings */
+static ztimer_base_t *_heap_merge_pairs(const ztimer_clock_t *clock,
+                                        ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+    ztimer_base_t *res = NULL;
+
+    /* meld pairs left to right, collecting them in reverse order */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        if (b) {
+            first = b->next;
+            a = _heap_meld(clock, a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+    /* meld the pairs right to left */
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+
+        pairs->next = NULL;
+        res = (res) ? _heap_meld(clock, res, pairs) : pairs;
+        pairs = next;
+    }
+    return res;
+}
+
+static void _heap_set_root(ztimer_clock_t *clock, ztimer_base_t *root)
+{
+    clock->list.next = root;
+    if (root) {
+        /* the clock's list entry doubles as "parent" of the root */
+        root->prev = &clock->list;
+        root->next = NULL;
+    }
+}
+
+static void _heap_remove(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *sub = _heap_merge_pairs(clock, entry->child);
+
+    if (entry == clock->list.next) {
+        _heap_set_root(clock, sub);
+    }
+    else {
+        /* unlink from parent (if leftmost child) or left sibling */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        if (sub) {
+            _heap_set_root(clock, _heap_meld(clock, clock->list.next, sub));
+        }
+    }
+    entry->next = NULL;
+    entry->child = NULL;
+    entry->prev = NULL;
+}
+
+/* moves all timers with a target up to now into the expired list and
+ * makes now the clock's new base */
+static void _heap_expire(ztimer_clock_t *clock, uint32_t now)
+{
+    uint32_t diff = now - clock->list.offset;
+    ztimer_base_t *root;
+
+    while ((root = clock->list.next) &&
+           ((root->offset - clock->list.offset) <= diff)) {
+        _heap_remove(clock, root);
+        /* expired timers have the clock's list as prev, too, but are never
+         * the root */
+        root->prev = &clock->list;
+        if (clock->last) {
+            clock->last->next = root;
+        }
+        else {
+            clock->expired = root;
+        }
+        clock->last = root;
+    }
+    clock->list.offset = now;
+}
+
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#ifdef MODULE_PM_LAYERED
+    /* First timer on the clock */
+    if (_first(clock) == NULL &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->required_pm_mode);
+    }
+#endif
+
+    /* the base is up to date (see ztimer_set()), so the relative offset
+     * becomes an absolute target */
+    entry->offset += clock->list.offset;
+    entry->next = NULL;
+    entry->child = NULL;
+    entry->armed = _armed_tag(clock, entry);
+    if (clock->list.next) {
+        _heap_set_root(clock, _heap_meld(clock, clock->list.next, entry));
+    }
+    else {
+        _heap_set_root(clock, entry);
+    }
+    DEBUG("_add_entry_to_list() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+
+void ztimer_update_head_offset(ztimer_clock_t *clock)
+{
+    _heap_expire(clock, ztimer_now(clock));
+}
+
+static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    DEBUG("_del_entry_from_list()\n");
+
+    assert(_is_set(clock, (ztimer_t *)entry));
+
+    if ((entry->prev == &clock->list) && (entry != clock->list.next)) {
+        /* entry is in the (short) expired list */
+        ztimer_base_t *prev = NULL;
+
+        for (ztimer_base_t *ptr = clock->expired; ptr; ptr = ptr->next) {
+            if (ptr == entry) {
+                if (prev) {
+                    prev->next = entry->next;
+                }
+                else {
+                    clock->expired = entry->next;
+                }
+                if (entry == clock->last) {
+                    clock->last = prev;
+                }
+                break;
+            }
+            prev = ptr;
+        }
+        entry->next = NULL;
+        entry->prev = NULL;
+    }
+    else {
+        _heap_remove(clock, entry);
+    }
+    entry->armed = 0;
+
+#ifdef MODULE_PM_LAYERED
+    /* The last timer just got removed from the clock */
+    if (_first(clock) == NULL &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->required_pm_mode);
+    }
+#endif
+}
+
+static ztimer_t *_now_next(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->expired;
+
+    if (entry) {
+        clock->expired = entry->next;
+        if (!entry->next) {
+            clock->last = NULL;
+        }
+        entry->next = NULL;
+        entry->child = NULL;
+        entry->prev = NULL;
+        entry->armed = 0;
+#ifdef MODULE_PM_LAYERED
+        /* The last timer just got removed from the clock */
+        if (_first(clock) == NULL &&
+            clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->required_pm_mode);
+        }
+#endif
+    }
+    return (ztimer_t *)entry;
+}
+
+static void _expire_head(ztimer_clock_t *clock)
+{
+    _heap_expire(clock, clock->list.offset + _head_offset(clock));
+}
+#else /* MODULE_ZTIMER_HEAP */
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -146,33 +444,6 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 }
 
-static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
-{
-    if (a < b) {
-        a += mod + 1;
-    }
-    return a - b;
-}
-
-#ifdef MODULE_ZTIMER_EXTEND
-ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
-{
-    assert(clock->max_value);
-    unsigned state = irq_disable();
-    uint32_t lower_now = clock->ops->now(clock);
-    DEBUG(
-        "ztimer_now() checkpoint=%" PRIu32 " lower_last=%" PRIu32 " lower_now=%" PRIu32 " diff=%" PRIu32 "\n",
-        (uint32_t)clock->checkpoint, clock->lower_last, lower_now,
-        _add_modulo(lower_now, clock->lower_last, clock->max_value));
-    clock->checkpoint += _add_modulo(lower_now, clock->lower_last,
-                                     clock->max_value);
-    clock->lower_last = lower_now;
-    DEBUG("ztimer_now() returning %" PRIu32 "\n", (uint32_t)clock->checkpoint);
-    ztimer_now_t now = clock->checkpoint;
-    irq_restore(state);
-    return now;
-}
-#endif /* MODULE_ZTIMER_EXTEND */
 
 void ztimer_update_head_offset(ztimer_clock_t *clock)
 {
@@ -276,13 +547,20 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+static void _expire_head(ztimer_clock_t *clock)
+{
+    clock->list.offset += clock->list.next->offset;
+    clock->list.next->offset = 0;
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
+        if (_first(clock)) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -293,8 +571,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_first(clock)) {
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -321,8 +599,8 @@ void ztimer_handler(ztimer_clock_t *clock)
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_first(clock)) {
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -346,8 +624,7 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    clock->list.offset += clock->list.next->offset;
-    clock->list.next->offset = 0;
+    _expire_head(clock);
 
     ztimer_t *entry = _now_next(clock);
     while (entry) {
@@ -374,6 +651,21 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_HEAP
+static void _ztimer_print(const ztimer_clock_t *clock)
+{
+    printf("base %" PRIu32 ", expired:", clock->list.offset);
+    for (const ztimer_base_t *entry = clock->expired; entry;
+         entry = entry->next) {
+        printf(" %p", (void *)entry);
+    }
+    if (clock->list.next) {
+        printf(", first %p:%" PRIu32, (void *)clock->list.next,
+               clock->list.next->offset);
+    }
+    puts("");
+}
+#else
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
     const ztimer_base_t *entry = &clock->list;
@@ -389,3 +681,4 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     } while ((entry = entry->next));
     puts("");
 }
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput of AES in bytes per cycle
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "kernel_defines.h"
+
+/* bytes processed per sample */
+#define TEST_BYTES      (1024U)
+#define TEST_SAMPLES    (20U)
+#define TEST_MAC_LEN    (8U)
+
+static const uint8_t _key[AES_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+static const uint8_t _nonce[13] = { 0 };
+/* 127 bytes is the maximum IEEE 802.15.4 frame */
+static const uint16_t _lens[] = { 16, 64, 127, TEST_BYTES };
+
+static uint8_t _buf[TEST_BYTES + TEST_MAC_LEN];
+static cipher_t _cipher;
+
+static const char *_impl(void)
+{
+#if IS_USED(MODULE_CRYPTO_AES_X86)
+    if (aes_x86_supported()) {
+        return "x86";
+    }
+#endif
+    if (IS_USED(MODULE_CRYPTO_AES_CT)) {
+        return "ct";
+    }
+    return "tables";
+}
+
+static void _encrypt(uint16_t len)
+{
+    for (unsigned i = 0; i < len; i += AES_BLOCK_SIZE) {
+        cipher_encrypt(&_cipher, &_buf[i], &_buf[i]);
+    }
+}
+
+static void _ctr(uint16_t len)
+{
+    uint8_t nonce_counter[16] = { 0 };
+
+    cipher_encrypt_ctr(&_cipher, nonce_counter, 8, _buf, len, _buf);
+}
+
+static void _ccm(uint16_t len)
+{
+    cipher_encrypt_ccm(&_cipher, NULL, 0, TEST_MAC_LEN, 2, _nonce,
+                       sizeof(_nonce), _buf, len, _buf);
+}
+
+static void _bench(const char *mode, void (*func)(uint16_t), uint16_t len)
+{
+    benchmark_stats_t stats;
+    unsigned runs = TEST_BYTES / len;
+
+    benchmark_cycles_init();
+    /* the first sample is a warm-up */
+    for (unsigned s = 0; s <= TEST_SAMPLES; s++) {
+        uint32_t time = benchmark_cycles_now();
+
+        for (unsigned i = 0; i < runs; i++) {
+            func(len);
+        }
+        time = benchmark_cycles_now() - time;
+        if (s > 0) {
+            benchmark_samples[s - 1] = time;
+        }
+    }
+    benchmark_stats(benchmark_samples, TEST_SAMPLES, &stats);
+    if (stats.median == 0) {
+        stats.median = 1;
+    }
+    printf("{ \"mode\" : \"%s\", \"len\" : %u, \"unit\" : \"%s\", "
+           "\"time_per_kib\" : %" PRIu32 ", \"bytes_per_kunit\" : %lu }\n",
+           mode, len, BENCHMARK_CYCLES_UNIT,
+           (uint32_t)(((uint64_t)stats.median * 1024U) / (runs * len)),
+           (unsigned long)(((uint64_t)runs * len * 1000U) / stats.median));
+}
+
+int main(void)
+{
+    puts("AES benchmark");
+
+    if (cipher_init(&_cipher, CIPHER_AES_128, _key, AES_KEY_SIZE) !=
+        CIPHER_INIT_SUCCESS) {
+        puts("[FAILED]");
+        return 1;
+    }
+    printf("implementation: %s\n", _impl());
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        /* only full blocks, like ECB */
+        _bench("encrypt", _encrypt, _lens[i] & ~(AES_BLOCK_SIZE - 1));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench("ctr", _ctr, _lens[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench("ccm", _ccm, _lens[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput of ChaCha20-Poly1305
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "crypto/chacha20poly1305.h"
+#include "kernel_defines.h"
+
+/* bytes processed per sample, a multiple of all lengths */
+#define TEST_BYTES      (2560U)
+#define TEST_SAMPLES    (20U)
+#define TEST_LEN_MAX    (1280U)
+/* the payload is split into a header and two halves like a packet */
+#define TEST_HDR_LEN    (40U)
+
+static const uint8_t _key[CHACHA20POLY1305_KEY_BYTES] = { 0x80 };
+static const uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES] = { 0x07 };
+static const uint8_t _aad[12] = { 0x50 };
+static const uint16_t _lens[] = { 64, 128, 256, 512, TEST_LEN_MAX };
+
+static uint8_t _buf[TEST_LEN_MAX + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t _tag[CHACHA20POLY1305_TAG_BYTES];
+
+static void _encrypt(uint16_t len)
+{
+    chacha20poly1305_encrypt(_buf, _buf, len, _aad, sizeof(_aad), _key,
+                             _nonce);
+}
+
+static void _decrypt(uint16_t len)
+{
+    size_t msglen;
+
+    /* the tag is wrong after the first run, so only the tag is computed
+     * then, just like for a forged message */
+    chacha20poly1305_decrypt(_buf, len + CHACHA20POLY1305_TAG_BYTES, _buf,
+                             &msglen, _aad, sizeof(_aad), _key, _nonce);
+}
+
+static void _encrypt_iolist(uint16_t len)
+{
+    uint16_t half = (len - TEST_HDR_LEN) / 2;
+    iolist_t aad = { .iol_base = (uint8_t *)_aad, .iol_len = sizeof(_aad) };
+    iolist_t data[] = {
+        { .iol_next = &data[1], .iol_base = _buf, .iol_len = TEST_HDR_LEN },
+        { .iol_next = &data[2], .iol_base = _buf + TEST_HDR_LEN,
+          .iol_len = half },
+        { .iol_next = NULL, .iol_base = _buf + TEST_HDR_LEN + half,
+          .iol_len = len - TEST_HDR_LEN - half },
+    };
+
+    chacha20poly1305_encrypt_iolist(data, &aad, _key, _nonce, _tag);
+}
+
+static void _bench(const char *mode, void (*func)(uint16_t), uint16_t len)
+{
+    benchmark_stats_t stats;
+    unsigned runs = TEST_BYTES / len;
+
+    benchmark_cycles_init();
+    /* the first sample is a warm-up */
+    for (unsigned s = 0; s <= TEST_SAMPLES; s++) {
+        uint32_t time = benchmark_cycles_now();
+
+        for (unsigned i = 0; i < runs; i++) {
+            func(len);
+        }
+        time = benchmark_cycles_now() - time;
+        if (s > 0) {
+            benchmark_samples[s - 1] = time;
+        }
+    }
+    benchmark_stats(benchmark_samples, TEST_SAMPLES, &stats);
+    if (stats.median == 0) {
+        stats.median = 1;
+    }
+    printf("{ \"mode\" : \"%s\", \"len\" : %u, \"unit\" : \"%s\", "
+           "\"time_per_kib\" : %" PRIu32 ", \"bytes_per_kunit\" : %lu }\n",
+           mode, len, BENCHMARK_CYCLES_UNIT,
+           (uint32_t)(((uint64_t)stats.median * 1024U) / (runs * len)),
+           (unsigned long)(((uint64_t)runs * len * 1000U) / stats.median));
+}
+
+int main(void)
+{
+    puts("ChaCha20-Poly1305 benchmark");
+    printf("key stream blocks: %u\n",
+           (unsigned)CONFIG_CHACHA20POLY1305_KEYSTREAM_BLOCKS);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench("encrypt", _encrypt, _lens[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench("decrypt", _decrypt, _lens[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench("encrypt_iolist", _encrypt_iolist, _lens[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
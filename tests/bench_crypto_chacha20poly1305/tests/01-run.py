@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("ChaCha20-Poly1305 benchmark")
+    child.expect(r"key stream blocks: \d+")
+    for mode in ("encrypt", "decrypt", "encrypt_iolist"):
+        for _ in range(5):
+            child.expect(r"{ \"mode\" : \"%s\", \"len\" : \d+, "
+                         r"\"unit\" : \"\w+\", \"time_per_kib\" : \d+, "
+                         r"\"bytes_per_kunit\" : \d+ }" % mode)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
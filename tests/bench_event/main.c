@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput and latency of event queues
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "event.h"
+#include "kernel_defines.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL)
+#endif
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES       (50U)
+#endif
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP        (5U)
+#endif
+
+#define EVENTS_NUMOF        (128U)
+
+static event_t _events[EVENTS_NUMOF];
+static event_t _urgent;
+static event_queue_t _queue;
+static const unsigned _lens[] = { 1, 8, 32, EVENTS_NUMOF };
+static char _name[48];
+
+static void _handler(event_t *event)
+{
+    (void)event;
+}
+
+static void _fill(unsigned len)
+{
+    for (unsigned i = 0; i < len; i++) {
+        event_post(&_queue, &_events[i]);
+    }
+}
+
+static void _drain(void)
+{
+    while (event_get(&_queue)) {}
+}
+
+/* take the first event and queue it again */
+static void _get_post(void)
+{
+    event_post(&_queue, event_get(&_queue));
+}
+
+/* re-arm the newest event, the worst case for a search of the list */
+static void _cancel_post(event_t *event)
+{
+    event_cancel(&_queue, event);
+    event_post(&_queue, event);
+}
+
+/* time from posting the urgent event until it is taken from a queue of
+ * len other events */
+static void _latency(unsigned len)
+{
+    benchmark_stats_t stats;
+
+    benchmark_cycles_init();
+    for (unsigned s = 0; s < BENCH_SAMPLES; s++) {
+        uint32_t time;
+        event_t *event;
+
+        _fill(len);
+        time = benchmark_cycles_now();
+        event_post(&_queue, &_urgent);
+        while ((event = event_get(&_queue)) != &_urgent) {
+            event->handler(event);
+        }
+        time = benchmark_cycles_now() - time;
+        benchmark_samples[s] = time;
+        _drain();
+    }
+    benchmark_stats(benchmark_samples, BENCH_SAMPLES, &stats);
+    snprintf(_name, sizeof(_name), "urgent latency, len=%u", len);
+    benchmark_print_stats(_name, 1, BENCH_SAMPLES, &stats);
+}
+
+static void _check(void)
+{
+    _fill(3);
+    event_post(&_queue, &_urgent);
+    event_cancel(&_queue, &_events[1]);
+    /* urgent events overtake, the rest stays in FIFO order */
+    if (IS_USED(MODULE_EVENT_PRIO)) {
+        expect(event_get(&_queue) == &_urgent);
+    }
+    expect(event_get(&_queue) == &_events[0]);
+    expect(event_get(&_queue) == &_events[2]);
+    if (!IS_USED(MODULE_EVENT_PRIO)) {
+        expect(event_get(&_queue) == &_urgent);
+    }
+    expect(event_get(&_queue) == NULL);
+}
+
+int main(void)
+{
+    puts("Event queue benchmark");
+    printf("event_dlist: %u, event_prio: %u\n",
+           IS_USED(MODULE_EVENT_DLIST), IS_USED(MODULE_EVENT_PRIO));
+
+    event_queue_init(&_queue);
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].handler = _handler;
+    }
+    _urgent.handler = _handler;
+#if IS_USED(MODULE_EVENT_PRIO)
+    _urgent.prio = CONFIG_EVENT_PRIO_NUMOF - 1;
+#endif
+    _check();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        unsigned len = _lens[i];
+
+        _fill(len);
+        snprintf(_name, sizeof(_name), "get/post, len=%u", len);
+        BENCHMARK_SAMPLES(_name, BENCH_WARMUP, BENCH_SAMPLES, BENCH_RUNS,
+                          _get_post());
+        snprintf(_name, sizeof(_name), "cancel/post, len=%u", len);
+        BENCHMARK_SAMPLES(_name, BENCH_WARMUP, BENCH_SAMPLES, BENCH_RUNS,
+                          _cancel_post(&_events[len - 1]));
+        _drain();
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _latency(_lens[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
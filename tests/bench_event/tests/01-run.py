@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+LENS = (1, 8, 32, 128)
+STATS = (r"\"unit\" : \"\w+\", \"runs\" : \d+, \"samples\" : \d+, "
+         r"\"min\" : \d+, \"median\" : \d+, \"p99\" : \d+, \"max\" : \d+, "
+         r"\"mean\" : \d+ }")
+
+
+def testfunc(child):
+    child.expect_exact("Event queue benchmark")
+    child.expect(r"event_dlist: [01], event_prio: [01]")
+    for length in LENS:
+        for name in ("get/post", "cancel/post"):
+            child.expect(r"{ \"name\" : \"%s, len=%d\", " % (name, length) +
+                         STATS)
+    for length in LENS:
+        child.expect(r"{ \"name\" : \"urgent latency, len=%d\", " % length +
+                     STATS)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
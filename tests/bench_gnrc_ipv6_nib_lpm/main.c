@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures route lookups in the NIB with a growing forwarding
+ *              table
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (100000U)
+#endif
+
+/* number of distinct destinations the lookups cycle through */
+#define TEST_DSTS           (1024U)
+#define TEST_IFACE          (1U)
+
+static const unsigned _routes_numof[] = { 10, 100, 1000, 5000 };
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+    0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+} };
+
+static ipv6_addr_t _routes[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static uint8_t _routes_len[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static ipv6_addr_t _dsts[TEST_DSTS];
+
+static void _random_addr(ipv6_addr_t *addr)
+{
+    for (unsigned i = 0; i < sizeof(addr->u32) / sizeof(addr->u32[0]); i++) {
+        addr->u32[i].u32 = random_uint32();
+    }
+    /* 2001:db8::/32 */
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+}
+
+static int _add_routes(unsigned start, unsigned end)
+{
+    for (unsigned i = start; i < end; i++) {
+        ipv6_addr_t pfx;
+
+        _random_addr(&pfx);
+        /* prefixes between /33 and /64, many of them nested */
+        _routes_len[i] = 33 + (random_uint32() % 32);
+        ipv6_addr_init_prefix(&_routes[i], &pfx, _routes_len[i]);
+        if (gnrc_ipv6_nib_ft_add(&_routes[i], _routes_len[i], &_next_hop,
+                                 TEST_IFACE, 0) < 0) {
+            printf("error adding route %u\n", i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _gen_dsts(unsigned routes)
+{
+    for (unsigned i = 0; i < TEST_DSTS; i++) {
+        ipv6_addr_t host;
+        unsigned route = random_uint32_range(0, routes);
+
+        _random_addr(&host);
+        memcpy(&_dsts[i], &host, sizeof(_dsts[i]));
+        ipv6_addr_init_prefix(&_dsts[i], &_routes[route], _routes_len[route]);
+    }
+}
+
+static int _bench(unsigned routes)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    uint32_t start, time;
+
+    _gen_dsts(routes);
+    /* all destinations must be routed */
+    for (unsigned i = 0; i < TEST_DSTS; i++) {
+        if (gnrc_ipv6_nib_ft_get(&_dsts[i], NULL, &fte) < 0) {
+            puts("error: destination not routed");
+            return -1;
+        }
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        gnrc_ipv6_nib_ft_get(&_dsts[i % TEST_DSTS], NULL, &fte);
+    }
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"lpm\" : %s, \"routes\" : %u, \"lookups\" : %u, "
+           "\"time_us\" : %lu, \"lookups_per_s\" : %lu }\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_LPM) ? "true" : "false", routes,
+           TEST_LOOKUPS, (unsigned long)time,
+           (unsigned long)(((uint64_t)TEST_LOOKUPS * US_PER_SEC) / time));
+    return 0;
+}
+
+int main(void)
+{
+    unsigned routes = 0;
+
+    puts("NIB route lookup benchmark");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes_numof); i++) {
+        if (_routes_numof[i] > CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) {
+            printf("CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF too small for %u routes\n",
+                   _routes_numof[i]);
+            return 1;
+        }
+        if ((_add_routes(routes, _routes_numof[i]) < 0) ||
+            (_bench(_routes_numof[i]) < 0)) {
+            return 1;
+        }
+        routes = _routes_numof[i];
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
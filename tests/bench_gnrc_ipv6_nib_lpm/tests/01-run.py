@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+ROUTES = (10, 100, 1000, 5000)
+
+
+def testfunc(child):
+    child.expect_exact("NIB route lookup benchmark")
+    for routes in ROUTES:
+        child.expect(r"{ \"lpm\" : (true|false), \"routes\" : (\d+), "
+                     r"\"lookups\" : \d+, \"time_us\" : \d+, "
+                     r"\"lookups_per_s\" : \d+ }")
+        assert int(child.match.group(2)) == routes
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=300))
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures neighbor cache lookups in the NIB with a growing
+ *              neighbor cache
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (100000U)
+#endif
+
+/* number of lookups the destinations are shuffled for */
+#define TEST_DSTS           (1024U)
+
+static const unsigned _neighbors_numof[] = { 10, 100, 1000 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static ipv6_addr_t _neighbors[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _dsts[TEST_DSTS];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _add_neighbors(unsigned start, unsigned end)
+{
+    for (unsigned i = start; i < end; i++) {
+        uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+        /* fe80::/64 with a random interface identifier */
+        ipv6_addr_set_link_local_prefix(&_neighbors[i]);
+        _neighbors[i].u32[2].u32 = random_uint32();
+        _neighbors[i].u32[3].u32 = random_uint32();
+        memcpy(l2addr, &_neighbors[i].u8[10], sizeof(l2addr));
+        if (gnrc_ipv6_nib_nc_set(&_neighbors[i], _netif.pid, l2addr,
+                                 sizeof(l2addr)) < 0) {
+            printf("error adding neighbor %u\n", i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _bench(unsigned neighbors)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t start, time;
+
+    for (unsigned i = 0; i < TEST_DSTS; i++) {
+        _dsts[i] = random_uint32_range(0, neighbors);
+        /* all neighbors must be resolved */
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&_neighbors[_dsts[i]], &_netif,
+                                              NULL, &nce) < 0) {
+            puts("error: neighbor not resolved");
+            return -1;
+        }
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        gnrc_ipv6_nib_get_next_hop_l2addr(&_neighbors[_dsts[i % TEST_DSTS]],
+                                          &_netif, NULL, &nce);
+    }
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"nc_hash\" : %s, \"neighbors\" : %u, \"lookups\" : %u, "
+           "\"time_us\" : %lu, \"lookups_per_s\" : %lu }\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) ? "true" : "false",
+           neighbors, TEST_LOOKUPS, (unsigned long)time,
+           (unsigned long)(((uint64_t)TEST_LOOKUPS * US_PER_SEC) / time));
+    return 0;
+}
+
+int main(void)
+{
+    unsigned neighbors = 0;
+
+    puts("NIB neighbor cache lookup benchmark");
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "bench_eth",
+                                   &_netdev.netdev) < 0) {
+        puts("error creating interface");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_neighbors_numof); i++) {
+        if (_neighbors_numof[i] > CONFIG_GNRC_IPV6_NIB_NUMOF) {
+            printf("CONFIG_GNRC_IPV6_NIB_NUMOF too small for %u neighbors\n",
+                   _neighbors_numof[i]);
+            return 1;
+        }
+        if ((_add_neighbors(neighbors, _neighbors_numof[i]) < 0) ||
+            (_bench(_neighbors_numof[i]) < 0)) {
+            return 1;
+        }
+        neighbors = _neighbors_numof[i];
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
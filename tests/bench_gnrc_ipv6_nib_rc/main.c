@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures next hop resolution in the NIB for a growing number
+ *              of destinations
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (100000U)
+#endif
+
+#define TEST_ROUTES         (100U)
+#define TEST_DSTS_MAX       (16U)
+
+static const unsigned _dsts_numof[] = { 1, 4, 8, TEST_DSTS_MAX };
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+    0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+} };
+static const uint8_t _next_hop_l2addr[] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x02
+};
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static ipv6_addr_t _routes[TEST_ROUTES];
+static ipv6_addr_t _dsts[TEST_DSTS_MAX];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _add_routes(void)
+{
+    if (gnrc_ipv6_nib_nc_set(&_next_hop, _netif.pid, _next_hop_l2addr,
+                             sizeof(_next_hop_l2addr)) < 0) {
+        puts("error adding next hop");
+        return -1;
+    }
+    for (unsigned i = 0; i < TEST_ROUTES; i++) {
+        /* 2001:db8:<i>::/48 */
+        memset(&_routes[i], 0, sizeof(_routes[i]));
+        _routes[i].u16[0] = byteorder_htons(0x2001);
+        _routes[i].u16[1] = byteorder_htons(0x0db8);
+        _routes[i].u16[2] = byteorder_htons(i);
+        if (gnrc_ipv6_nib_ft_add(&_routes[i], 48, &_next_hop, _netif.pid,
+                                 0) < 0) {
+            printf("error adding route %u\n", i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _get_stats(uint32_t *hits, uint32_t *misses)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC)
+    gnrc_ipv6_nib_rc_stats_t stats;
+
+    gnrc_ipv6_nib_rc_get_stats(&stats);
+    *hits = stats.hits;
+    *misses = stats.misses;
+#else
+    *hits = 0;
+    *misses = 0;
+#endif
+}
+
+static int _bench(unsigned dsts)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t start, time, hits, misses, tmp_hits, tmp_misses;
+    unsigned hit_rate;
+
+    for (unsigned i = 0; i < dsts; i++) {
+        memcpy(&_dsts[i], &_routes[random_uint32_range(0, TEST_ROUTES)],
+               sizeof(_dsts[i]));
+        _dsts[i].u32[2].u32 = random_uint32();
+        _dsts[i].u32[3].u32 = random_uint32();
+        /* all destinations must be resolved */
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&_dsts[i], &_netif, NULL,
+                                              &nce) < 0) {
+            puts("error: destination not resolved");
+            return -1;
+        }
+    }
+
+    _get_stats(&hits, &misses);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        gnrc_ipv6_nib_get_next_hop_l2addr(&_dsts[i % dsts], &_netif, NULL,
+                                          &nce);
+    }
+    time = xtimer_now_usec() - start;
+    _get_stats(&tmp_hits, &tmp_misses);
+    hits = tmp_hits - hits;
+    misses = tmp_misses - misses;
+    hit_rate = ((hits + misses) == 0) ? 0U
+             : (unsigned)(((uint64_t)hits * 100U) / (hits + misses));
+
+    printf("{ \"rc\" : %s, \"dsts\" : %u, \"lookups\" : %u, "
+           "\"time_us\" : %lu, \"lookups_per_s\" : %lu, \"hit_rate\" : %u }\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_RC) ? "true" : "false",
+           dsts, TEST_LOOKUPS, (unsigned long)time,
+           (unsigned long)(((uint64_t)TEST_LOOKUPS * US_PER_SEC) / time),
+           hit_rate);
+    return 0;
+}
+
+int main(void)
+{
+    puts("NIB route cache benchmark");
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "bench_eth",
+                                   &_netdev.netdev) < 0) {
+        puts("error creating interface");
+        return 1;
+    }
+    if (_add_routes() < 0) {
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_dsts_numof); i++) {
+        if (_bench(_dsts_numof[i]) < 0) {
+            return 1;
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
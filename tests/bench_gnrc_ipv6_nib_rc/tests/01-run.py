@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+DSTS = (1, 4, 8, 16)
+
+
+def testfunc(child):
+    child.expect_exact("NIB route cache benchmark")
+    for dsts in DSTS:
+        child.expect(r"{ \"rc\" : (true|false), \"dsts\" : (\d+), "
+                     r"\"lookups\" : \d+, \"time_us\" : \d+, "
+                     r"\"lookups_per_s\" : \d+, \"hit_rate\" : (\d+) }")
+        assert int(child.match.group(2)) == dsts
+        if child.match.group(1) == "false":
+            assert int(child.match.group(3)) == 0
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=300))
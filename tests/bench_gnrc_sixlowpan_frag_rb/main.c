@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures reassembly buffer look-ups against the number of
+ *              datagrams in reassembly
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/sixlowpan.h"
+#include "xtimer.h"
+
+#ifndef TEST_ROUNDS
+#define TEST_ROUNDS             (100U)
+#endif
+
+#define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
+                                  0x78, 0xfe, 0x95, 0x00 }
+#define TEST_NETIF_HDR_DST      { 0xa4, 0xf2, 0xd2, 0xc9, \
+                                  0x13, 0xb9, 0xbb, 0x25 }
+#define TEST_PAGE               (0)
+
+#define TEST_DATAGRAM_SIZE      (348U)
+#define TEST_FRAGMENT_SIZE      (96U)
+#define TEST_FRAGMENT_NUMOF     ((TEST_DATAGRAM_SIZE + TEST_FRAGMENT_SIZE - 1) / \
+                                 TEST_FRAGMENT_SIZE)
+/* uncompressed IPv6 header of the datagram (IPv6 dispatch is prepended) */
+#define TEST_IPV6_HDR           { \
+        0x60, 0x00, 0x00, 0x00, 0x01, 0x34, 0x3a, 0x40, \
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+        0x7b, 0x65, 0x08, 0x22, 0x86, 0x93, 0x9d, 0x5a, \
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+        0x7b, 0x79, 0x7f, 0x7f, 0xa4, 0xb1, 0x55, 0x2e, \
+    }
+
+static const uint8_t _ipv6_hdr[] = TEST_IPV6_HDR;
+static uint8_t _test_netif_hdr_src[] = TEST_NETIF_HDR_SRC;
+static const uint8_t _test_netif_hdr_dst[] = TEST_NETIF_HDR_DST;
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint8_t dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+} _netif_hdr;
+
+/* largest fragment: FRAGN header + payload */
+static uint8_t _fragment[sizeof(sixlowpan_frag_n_t) + TEST_FRAGMENT_SIZE];
+
+static size_t _build_fragment(uint16_t tag, unsigned idx)
+{
+    sixlowpan_frag_t *hdr = (sixlowpan_frag_t *)_fragment;
+    unsigned offset = idx * TEST_FRAGMENT_SIZE;
+    size_t size = TEST_DATAGRAM_SIZE - offset;
+
+    if (size > TEST_FRAGMENT_SIZE) {
+        size = TEST_FRAGMENT_SIZE;
+    }
+    hdr->disp_size = byteorder_htons(TEST_DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (idx == 0) {
+        uint8_t *data = _fragment + sizeof(sixlowpan_frag_t);
+
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        data[0] = SIXLOWPAN_UNCOMP;
+        memcpy(&data[1], _ipv6_hdr, sizeof(_ipv6_hdr));
+        memset(&data[1 + sizeof(_ipv6_hdr)], 0x54, size - sizeof(_ipv6_hdr));
+        return sizeof(sixlowpan_frag_t) + 1 + size;
+    }
+    else {
+        sixlowpan_frag_n_t *hdr_n = (sixlowpan_frag_n_t *)_fragment;
+
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr_n->offset = offset / 8;
+        memset(_fragment + sizeof(sixlowpan_frag_n_t), 0x54, size);
+        return sizeof(sixlowpan_frag_n_t) + size;
+    }
+}
+
+static void _set_src(unsigned datagram)
+{
+    _test_netif_hdr_src[sizeof(_test_netif_hdr_src) - 1] = datagram;
+    gnrc_netif_hdr_set_src_addr(&_netif_hdr.hdr, _test_netif_hdr_src,
+                                sizeof(_test_netif_hdr_src));
+}
+
+static int _add_fragment(unsigned datagram, uint16_t tag, unsigned idx)
+{
+    gnrc_sixlowpan_frag_rb_t *entry;
+    size_t size = _build_fragment(tag, idx);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment, size,
+                                          GNRC_NETTYPE_SIXLOWPAN);
+
+    if (pkt == NULL) {
+        return -1;
+    }
+    _set_src(datagram);
+    entry = gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt,
+                                       idx * TEST_FRAGMENT_SIZE, TEST_PAGE);
+    if (entry == NULL) {
+        return -1;
+    }
+    /* releases the completed datagram, as there is no receiver */
+    gnrc_sixlowpan_frag_rb_dispatch_when_complete(entry, &_netif_hdr.hdr);
+    return 0;
+}
+
+static int _bench(unsigned datagrams)
+{
+    uint32_t start, time;
+    uint16_t tag = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned round = 0; round < TEST_ROUNDS; round++) {
+        /* send all datagrams of this round interleaved */
+        for (unsigned idx = 0; idx < TEST_FRAGMENT_NUMOF; idx++) {
+            for (unsigned d = 0; d < datagrams; d++) {
+                if (_add_fragment(d, tag + d, idx) < 0) {
+                    printf("error adding fragment %u of datagram %u\n",
+                           idx, d);
+                    return -1;
+                }
+            }
+        }
+        tag += datagrams;
+    }
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"datagrams\" : %u, \"ns_per_fragment\" : %lu }\n", datagrams,
+           (unsigned long)(((uint64_t)time * 1000) /
+                           (TEST_ROUNDS * TEST_FRAGMENT_NUMOF * datagrams)));
+    return 0;
+}
+
+int main(void)
+{
+    puts("6LoWPAN reassembly buffer benchmark");
+    printf("look-up: %s\n", IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_HASH) ? "hash"
+                                                                      : "linear");
+
+    gnrc_pktbuf_init();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, sizeof(_test_netif_hdr_src),
+                        sizeof(_test_netif_hdr_dst));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, _test_netif_hdr_dst,
+                                sizeof(_test_netif_hdr_dst));
+
+    for (unsigned datagrams = 1; datagrams <= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+         datagrams *= 2) {
+        if (_bench(datagrams) < 0) {
+            return 1;
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
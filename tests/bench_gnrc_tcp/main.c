@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput of GNRC TCP
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define CHUNK_SIZE          (4096U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static char _buf[CHUNK_SIZE];
+
+static int _bench_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    size_t total, sent = 0;
+    uint32_t start, time;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("invalid endpoint %s\n", argv[1]);
+        return 1;
+    }
+    total = atol(argv[2]);
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = '0' + (i % 10);
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open_active(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("error opening connection: %d\n", res);
+        return 1;
+    }
+
+    start = xtimer_now_usec();
+    while (sent < total) {
+        size_t len = ((total - sent) < sizeof(_buf)) ? (total - sent) : sizeof(_buf);
+        ssize_t ret = gnrc_tcp_send(&_tcb, _buf, len, 0);
+
+        if (ret < 0) {
+            printf("error sending data: %d\n", (int)ret);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += ret;
+    }
+    /* closing waits until all data was acknowledged */
+    gnrc_tcp_close(&_tcb);
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"gnrc_tcp_cc\" : %s, \"bytes\" : %u, \"time_us\" : %lu, "
+           "\"bytes_per_s\" : %lu }\n",
+           IS_USED(MODULE_GNRC_TCP_CC) ? "true" : "false", (unsigned)sent,
+           (unsigned long)time,
+           (unsigned long)(((uint64_t)sent * US_PER_SEC) / time));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "send data to a TCP server and measure throughput", _bench_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC TCP throughput benchmark");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import random
+import re
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+BENCH_BYTES = 1024 * 1024
+
+
+def tcp_server(sock, received):
+    conn, _ = sock.accept()
+    with conn:
+        while True:
+            data = conn.recv(65536)
+            if not data:
+                break
+            received[0] += len(data)
+
+
+def get_host_tap_device():
+    # Use bridge, if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    result = os.popen('bridge link show dev {}'.format(tap))
+    bridge = re.search('master (.*) state', result.read())
+
+    return bridge.group(1).strip() if bridge else tap
+
+
+def get_host_ll_addr(interface):
+    result = os.popen('ip addr show dev ' + interface + ' scope link')
+    return re.search('inet6 (.*)/64', result.read()).group(1).strip()
+
+
+def get_riot_if_id(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1).strip()
+
+
+def testfunc(child):
+    child.expect_exact("GNRC TCP throughput benchmark")
+    port = random.randint(1024, 65535)
+    received = [0]
+
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        sock.bind(('::', port))
+        sock.listen(1)
+        server = threading.Thread(target=tcp_server, args=(sock, received))
+        server.start()
+
+        addr = get_host_ll_addr(get_host_tap_device())
+        child.sendline('bench [{}%{}]:{} {}'.format(addr, get_riot_if_id(child),
+                                                    port, BENCH_BYTES))
+        child.expect(r"{ \"gnrc_tcp_cc\" : (true|false), \"bytes\" : (\d+), "
+                     r"\"time_us\" : \d+, \"bytes_per_s\" : \d+ }")
+        assert int(child.match.group(2)) == BENCH_BYTES
+        server.join()
+    assert received[0] == BENCH_BYTES
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput of SHA-256
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+/* number of bytes hashed per measurement */
+#define TEST_BYTES      (64UL * 1024UL)
+#endif
+
+#define TEST_LEN_MAX    (512U)
+/* number of buffers hashed by one call of sha256_multi() */
+#define TEST_MULTI      (8U)
+
+static uint8_t _buf[TEST_MULTI * TEST_LEN_MAX];
+static uint8_t _digests[TEST_MULTI][SHA256_DIGEST_LENGTH];
+static const uint16_t _lens[] = { 32, 64, 256, TEST_LEN_MAX };
+
+static const char *_impl(void)
+{
+    if (IS_USED(MODULE_HASHES_SHA2XX_X86)) {
+        return "x86";
+    }
+    if (IS_USED(MODULE_HASHES_SHA2XX_UNROLLED)) {
+        return "unrolled";
+    }
+    return "loop";
+}
+
+static void _print(const char *func, uint16_t len, unsigned long bytes,
+                   uint32_t time)
+{
+    if (time == 0) {
+        time = 1;
+    }
+    printf("{ \"func\" : \"%s\", \"len\" : %u, \"kib_per_s\" : %lu }\n",
+           func, len,
+           (unsigned long)(((uint64_t)bytes * US_PER_SEC) / (1024U * time)));
+}
+
+static void _bench_single(uint16_t len)
+{
+    unsigned rounds = TEST_BYTES / len;
+    uint32_t start, time;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < rounds; i++) {
+        /* hash the previous digest as well, so no call can be optimized
+         * out */
+        sha256(_buf, len, _buf);
+    }
+    time = xtimer_now_usec() - start;
+    _print("sha256", len, (unsigned long)rounds * len, time);
+}
+
+static void _bench_multi(uint16_t len)
+{
+    const void *data[TEST_MULTI];
+    size_t lens[TEST_MULTI];
+    void *digests[TEST_MULTI];
+    unsigned rounds = TEST_BYTES / (len * TEST_MULTI);
+    uint32_t start, time;
+
+    for (unsigned i = 0; i < TEST_MULTI; i++) {
+        data[i] = &_buf[i * TEST_LEN_MAX];
+        lens[i] = len;
+        digests[i] = _digests[i];
+    }
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < rounds; i++) {
+        sha256_multi(data, lens, digests, TEST_MULTI);
+    }
+    time = xtimer_now_usec() - start;
+    _print("sha256_multi", len, (unsigned long)rounds * len * TEST_MULTI,
+           time);
+}
+
+int main(void)
+{
+    puts("SHA-256 benchmark");
+    printf("implementation: %s\n", _impl());
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench_single(_lens[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench_multi(_lens[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
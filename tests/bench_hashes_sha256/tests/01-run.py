@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("SHA-256 benchmark")
+    child.expect(r"implementation: (loop|unrolled|x86)")
+    for func in ("sha256", "sha256_multi"):
+        for _ in range(4):
+            child.expect(r"{ \"func\" : \"%s\", \"len\" : \d+, "
+                         r"\"kib_per_s\" : \d+ }" % func)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
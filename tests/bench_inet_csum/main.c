@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the throughput of the Internet Checksum calculation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+/* number of bytes summed up per measurement */
+#define TEST_BYTES      (256UL * 1024UL)
+#endif
+
+#define TEST_LEN_MAX    (1280U)
+
+/* one additional byte to measure at an odd offset */
+static uint32_t _buf[(TEST_LEN_MAX + 1 + sizeof(uint32_t) - 1) /
+                     sizeof(uint32_t)];
+static const uint16_t _lens[] = { 8, 40, 128, 512, TEST_LEN_MAX };
+
+static void _bench(uint16_t len, unsigned offset)
+{
+    const uint8_t *buf = (uint8_t *)_buf + offset;
+    unsigned rounds = TEST_BYTES / len;
+    uint16_t sum = 0;
+    uint32_t start, time;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < rounds; i++) {
+        /* chain the results, so no call can be optimized out */
+        sum = inet_csum(sum, buf, len);
+    }
+    time = xtimer_now_usec() - start;
+
+    if (time == 0) {
+        time = 1;
+    }
+    printf("{ \"len\" : %u, \"offset\" : %u, \"kib_per_s\" : %lu }\n",
+           len, offset,
+           (unsigned long)(((uint64_t)rounds * len * US_PER_SEC) /
+                           (1024U * time)));
+    /* keep sum used */
+    if (sum == 0) {
+        puts("(sum is zero)");
+    }
+}
+
+int main(void)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+
+    puts("Internet Checksum benchmark");
+    printf("implementation: %s\n", IS_USED(MODULE_INET_CSUM_WORD) ? "word"
+                                                                   : "byte");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        buf[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        for (unsigned offset = 0; offset < 2; offset++) {
+            _bench(_lens[i], offset);
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure messages sent per second with msg_send_batch()
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include "macros/units.h"
+#include "thread.h"
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef TEST_BATCH_MAX
+#define TEST_BATCH_MAX      (32U)
+#endif
+
+volatile unsigned _flag = 0;
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[TEST_BATCH_MAX];
+
+static void _timer_callback(void*arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+    msg_t test[TEST_BATCH_MAX];
+
+    msg_init_queue(_queue, TEST_BATCH_MAX);
+
+    while(1) {
+        msg_receive_batch(test, TEST_BATCH_MAX);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    printf("main starting\n");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       THREAD_CREATE_STACKTEST,
+                                       _second_thread,
+                                       NULL,
+                                       "second_thread");
+
+    xtimer_t timer = { 0 };
+    timer.callback = _timer_callback;
+
+    msg_t test[TEST_BATCH_MAX];
+
+    for (unsigned batch = 1; batch <= TEST_BATCH_MAX; batch *= 2) {
+        uint32_t n = 0;
+
+        _flag = 0;
+        xtimer_set(&timer, TEST_DURATION);
+        while(!_flag) {
+            n += msg_send_batch(test, batch, other);
+        }
+
+        printf("{ \"batch\" : %u, \"result\" : %"PRIu32, batch, n);
+#ifdef CLOCK_CORECLOCK
+        printf(", \"ticks\" : %"PRIu32,
+               (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
+#endif
+        puts(" }");
+    }
+
+    return 0;
+}
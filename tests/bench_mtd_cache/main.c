@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures MTD access patterns of file systems with and
+ *              without mtd_cache
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "board.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+#define TEST_SAMPLES        (10U)
+/* bytes accessed per sample */
+#define TEST_BYTES          (4096U)
+#define TEST_CHUNK          (16U)
+
+#ifndef CACHE_LINES
+#define CACHE_LINES         (8U)
+#endif
+#ifndef CACHE_PAGE_SIZE
+#define CACHE_PAGE_SIZE     (256U)
+#endif
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/* Define MTD_0 in board.h to use the board mtd if any */
+#ifdef MTD_0
+#define _parent (MTD_0)
+#else
+/* Test mock object implementing a simple RAM-based mtd */
+#define SECTOR_COUNT        (4U)
+#define PAGE_PER_SECTOR     (16U)
+#define PAGE_SIZE           (256U)
+
+static uint8_t _dummy_memory[SECTOR_COUNT * PAGE_PER_SECTOR * PAGE_SIZE];
+
+static int _ram_init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _ram_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                          uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _ram_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                           uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(dev->page_size - offset, size);
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(_dummy_memory + addr, buff, size);
+
+    return size;
+}
+
+static int _ram_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t sector_size = dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    memset(_dummy_memory + sector * sector_size, 0xff, count * sector_size);
+
+    return 0;
+}
+
+static const mtd_desc_t _ram_driver = {
+    .init = _ram_init,
+    .read_page = _ram_read_page,
+    .write_page = _ram_write_page,
+    .erase_sector = _ram_erase_sector,
+};
+
+static mtd_dev_t _ram_dev = {
+    .driver = &_ram_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+#define _parent (&_ram_dev)
+#endif
+
+/* Counts the accesses to the parent device, i.e. the bus transactions */
+static unsigned _reads, _writes;
+
+static int _count_init(mtd_dev_t *dev)
+{
+    int res = mtd_init(_parent);
+
+    dev->sector_count = _parent->sector_count;
+    dev->pages_per_sector = _parent->pages_per_sector;
+    dev->page_size = _parent->page_size;
+    return res;
+}
+
+static int _count_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                            uint32_t offset, uint32_t size)
+{
+    (void)dev;
+    _reads++;
+    return (mtd_read_page(_parent, buff, page, offset, size) < 0) ? -EIO
+                                                                  : (int)size;
+}
+
+static int _count_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                             uint32_t offset, uint32_t size)
+{
+    (void)dev;
+    size = MIN(dev->page_size - offset, size);
+    _writes++;
+    return (mtd_write_page(_parent, buff, page, offset, size) < 0) ? -EIO
+                                                                   : (int)size;
+}
+
+static int _count_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+    return mtd_erase_sector(_parent, sector, count);
+}
+
+static const mtd_desc_t _count_driver = {
+    .init = _count_init,
+    .read_page = _count_read_page,
+    .write_page = _count_write_page,
+    .erase_sector = _count_erase_sector,
+};
+
+static mtd_dev_t _count_dev = { .driver = &_count_driver };
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * CACHE_PAGE_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_count_dev, _lines, _cache_buf);
+
+static uint8_t _buf[TEST_CHUNK];
+
+/* reads the area in small pieces, like file contents */
+static int _read_seq(mtd_dev_t *dev)
+{
+    for (uint32_t addr = 0; addr < TEST_BYTES; addr += TEST_CHUNK) {
+        int res = mtd_read(dev, _buf, addr, TEST_CHUNK);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+/* reads the same two pages over and over, like file system metadata */
+static int _read_meta(mtd_dev_t *dev)
+{
+    for (uint32_t i = 0; i < TEST_BYTES / TEST_CHUNK; i++) {
+        uint32_t addr = ((i & 1) ? dev->page_size * 4 : 0) +
+                        ((i * TEST_CHUNK) % dev->page_size);
+        int res = mtd_read(dev, _buf, addr, TEST_CHUNK);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+/* writes the area in small pieces, like file contents */
+static int _write_seq(mtd_dev_t *dev)
+{
+    memset(_buf, 0, sizeof(_buf));
+    for (uint32_t addr = 0; addr < TEST_BYTES; addr += TEST_CHUNK) {
+        int res = mtd_write(dev, _buf, addr, TEST_CHUNK);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return (dev == &_cache.mtd) ? mtd_cache_flush(&_cache) : 0;
+}
+
+static int _bench(const char *name, int (*func)(mtd_dev_t *), mtd_dev_t *dev,
+                  bool erase)
+{
+    benchmark_stats_t stats;
+    uint32_t sector_size = _count_dev.page_size * _count_dev.pages_per_sector;
+    uint32_t erase_size = ((TEST_BYTES + sector_size - 1) / sector_size) *
+                          sector_size;
+
+    benchmark_cycles_init();
+    for (unsigned s = 0; s < TEST_SAMPLES; s++) {
+        uint32_t time;
+        int res;
+
+        /* start with a cold cache and erased flash */
+        if ((mtd_init(dev) < 0) ||
+            (erase && (mtd_erase(dev, 0, erase_size) < 0))) {
+            return -EIO;
+        }
+        if (dev == &_cache.mtd) {
+            mtd_cache_stats_reset(&_cache);
+        }
+        _reads = 0;
+        _writes = 0;
+        time = benchmark_cycles_now();
+        res = func(dev);
+        time = benchmark_cycles_now() - time;
+        if (res < 0) {
+            return res;
+        }
+        benchmark_samples[s] = time;
+    }
+    benchmark_stats(benchmark_samples, TEST_SAMPLES, &stats);
+    printf("{ \"mode\" : \"%s\", \"dev\" : \"%s\", \"unit\" : \"%s\", "
+           "\"time_per_kib\" : %" PRIu32 ", \"reads_per_kib\" : %u, "
+           "\"writes_per_kib\" : %u }\n",
+           name, (dev == &_cache.mtd) ? "cache" : "direct",
+           BENCHMARK_CYCLES_UNIT,
+           (uint32_t)(((uint64_t)stats.median * 1024U) / TEST_BYTES),
+           (_reads * 1024U) / TEST_BYTES, (_writes * 1024U) / TEST_BYTES);
+    if (dev == &_cache.mtd) {
+        printf("hits: %" PRIu32 ", misses: %" PRIu32 ", read ahead: %" PRIu32
+               ", write backs: %" PRIu32 "\n",
+               _cache.stats.hits, _cache.stats.misses,
+               _cache.stats.read_ahead, _cache.stats.write_backs);
+    }
+    return 0;
+}
+
+int main(void)
+{
+    static const struct {
+        const char *name;
+        int (*func)(mtd_dev_t *);
+        bool erase;
+    } modes[] = {
+        { "read_seq", _read_seq, false },
+        { "read_meta", _read_meta, false },
+        { "write_seq", _write_seq, true },
+    };
+
+    puts("MTD cache benchmark");
+
+    if (mtd_init(&_count_dev) < 0) {
+        puts("[FAILED]");
+        return 1;
+    }
+    printf("page size: %" PRIu32 ", cache lines: %u\n", _count_dev.page_size,
+           (unsigned)CACHE_LINES);
+    if (_count_dev.page_size > CACHE_PAGE_SIZE) {
+        puts("page size too large, increase CACHE_PAGE_SIZE");
+        puts("[FAILED]");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(modes); i++) {
+        if ((_bench(modes[i].name, modes[i].func, &_count_dev,
+                    modes[i].erase) < 0) ||
+            (_bench(modes[i].name, modes[i].func, &_cache.mtd,
+                    modes[i].erase) < 0)) {
+            puts("[FAILED]");
+            return 1;
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
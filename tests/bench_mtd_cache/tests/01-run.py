@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+MODES = ("read_seq", "read_meta", "write_seq")
+RESULT = (r"{ \"mode\" : \"%s\", \"dev\" : \"%s\", \"unit\" : \"\w+\", "
+          r"\"time_per_kib\" : \d+, \"reads_per_kib\" : \d+, "
+          r"\"writes_per_kib\" : \d+ }")
+
+
+def testfunc(child):
+    child.expect_exact("MTD cache benchmark")
+    child.expect(r"page size: \d+, cache lines: \d+")
+    for mode in MODES:
+        child.expect(RESULT % (mode, "direct"))
+        child.expect(RESULT % (mode, "cache"))
+        child.expect(r"hits: \d+, misses: \d+, read ahead: \d+, "
+                     r"write backs: \d+")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    # creating the flash image of native takes a while
+    sys.exit(run(testfunc, timeout=60))
@@ -11,7 +11,7 @@
  * @{
  *
  * @file
- * @brief       Mutex context switch benchmark
+ * @brief       Mutex lock/unlock and context switch benchmark
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 
+#include "kernel_defines.h"
 #include "macros/units.h"
 #include "mutex.h"
 #include "thread.h"
@@ -32,6 +33,7 @@
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
+static mutex_t _uncontended = MUTEX_INIT;
 
 static void _timer_callback(void*arg)
 {
@@ -52,9 +54,37 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void _print_result(const char *name, uint32_t n)
+{
+    printf("{ \"%s\" : %"PRIu32, name, n);
+#ifdef CLOCK_CORECLOCK
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
+#endif
+    puts(" }");
+}
+
 int main(void)
 {
     printf("main starting\n");
+    printf("priority inheritance: %s, fast path: %s\n",
+           IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) ? "yes" : "no",
+           MUTEX_FAST_PATH ? "yes" : "no");
+
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    uint32_t n = 0;
+
+    /* lock and unlock a mutex no other thread uses */
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        mutex_lock(&_uncontended);
+        mutex_unlock(&_uncontended);
+        n++;
+    }
+
+    _print_result("uncontended", n);
 
     thread_create(_stack,
                   sizeof(_stack),
@@ -68,23 +98,17 @@ int main(void)
     mutex_lock(&_mutex);
     thread_yield_higher();
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
+    n = 0;
+    _flag = 0;
 
+    /* every unlock hands the mutex over to second_thread */
     xtimer_set(&timer, TEST_DURATION);
     while(!_flag) {
         mutex_unlock(&_mutex);
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-#ifdef CLOCK_CORECLOCK
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
-#endif
-    puts(" }");
+    _print_result("result", n);
 
     return 0;
 }
@@ -12,6 +12,8 @@ from testrunner import run
 
 
 def testfunc(child):
+    child.expect(r"priority inheritance: (yes|no), fast path: (yes|no)")
+    child.expect(r"{ \"uncontended\" : \d+(, \"ticks\" : \d+)? }")
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
 
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures coap_find_resource() against the number of resources
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/nanocoap.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_RESOURCES_NUMOF
+#define TEST_RESOURCES_NUMOF    (256U)
+#endif
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT             (1000U)
+#endif
+
+/* number of different URIs looked up per measurement */
+#define TEST_URI_NUMOF          (32U)
+#define TEST_URI_LEN            sizeof("/res/0000/0000")
+
+static char _paths[TEST_RESOURCES_NUMOF][sizeof("/res/0000")];
+static coap_resource_t _resources[TEST_RESOURCES_NUMOF];
+static char _uris[TEST_URI_NUMOF][TEST_URI_LEN];
+
+/* not part of the benchmark, but required by the nanocoap module */
+const coap_resource_t coap_resources[] = {
+    COAP_WELL_KNOWN_CORE_DEFAULT_HANDLER,
+};
+const unsigned coap_resources_numof = ARRAY_SIZE(coap_resources);
+
+static uint32_t _bench_lookup(unsigned numof, int exp)
+{
+    const coap_resource_t *resource;
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        const uint8_t *uri = (uint8_t *)_uris[i % TEST_URI_NUMOF];
+
+        if (coap_find_resource(_resources, numof, uri, COAP_GET,
+                               &resource) != exp) {
+            printf("unexpected result for %s\n", (char *)uri);
+            return 0;
+        }
+    }
+    return (((uint64_t)(xtimer_now_usec() - start)) * 1000) / TEST_REPEAT;
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t exact, subtree, no_path;
+
+    /* the zero-padded paths are already in the required order */
+    for (unsigned i = 0; i < numof; i++) {
+        snprintf(_paths[i], sizeof(_paths[i]), "/res/%04u", i);
+        _resources[i].path = _paths[i];
+        _resources[i].methods = COAP_GET;
+    }
+    _resources[numof - 1].methods |= COAP_MATCH_SUBTREE;
+
+    for (unsigned i = 0; i < TEST_URI_NUMOF; i++) {
+        snprintf(_uris[i], TEST_URI_LEN, "/res/%04u",
+                 (unsigned)random_uint32_range(0, numof));
+    }
+    exact = _bench_lookup(numof, 0);
+
+    for (unsigned i = 0; i < TEST_URI_NUMOF; i++) {
+        snprintf(_uris[i], TEST_URI_LEN, "/res/%04u/%04u", numof - 1,
+                 (unsigned)random_uint32_range(0, 10000));
+    }
+    subtree = _bench_lookup(numof, 0);
+
+    for (unsigned i = 0; i < TEST_URI_NUMOF; i++) {
+        snprintf(_uris[i], TEST_URI_LEN, "/res/%04u",
+                 (unsigned)random_uint32_range(numof, 2 * numof));
+    }
+    no_path = _bench_lookup(numof, -ENOENT);
+
+    printf("{ \"resources\" : %u, \"exact_ns\" : %lu, \"subtree_ns\" : %lu, "
+           "\"no_path_ns\" : %lu }\n", numof, (unsigned long)exact,
+           (unsigned long)subtree, (unsigned long)no_path);
+}
+
+int main(void)
+{
+    puts("nanocoap resource look-up benchmark");
+    printf("implementation: %s\n", IS_USED(MODULE_NANOCOAP_BSEARCH) ? "bsearch"
+                                                                      : "linear");
+
+    for (unsigned numof = 1; numof <= TEST_RESOURCES_NUMOF; numof *= 4) {
+        _bench(numof);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("nanocoap resource look-up benchmark")
+    child.expect(r"implementation: (linear|bsearch)")
+    child.expect(r"{ \"resources\" : \d+, \"exact_ns\" : \d+, "
+                 r"\"subtree_ns\" : \d+, \"no_path_ns\" : \d+ }")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
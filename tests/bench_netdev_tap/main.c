@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the frames per second netdev_tap can receive
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "msg.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/netdev.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_FRAMES
+#define TEST_FRAMES         (4096U)
+#endif
+
+#ifndef TEST_BURST
+#define TEST_BURST          (32U)
+#endif
+
+/* time to wait for the frames of a burst */
+#define TEST_TIMEOUT_US     (100U * US_PER_MS)
+/* local experimental EtherType */
+#define TEST_ETHERTYPE      (0x88b5)
+
+#define RX_MSG_QUEUE_SIZE   (8U)
+#define RX_MSG_TYPE_ISR     (0x3456)
+
+static netdev_tap_t _tx_dev;
+static netdev_tap_t _rx_dev;
+
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _rx_queue[RX_MSG_QUEUE_SIZE];
+static kernel_pid_t _rx_pid;
+
+static uint8_t _tx_buf[ETHERNET_FRAME_LEN];
+static uint8_t _rx_buf[ETHERNET_FRAME_LEN];
+
+static mutex_t _burst_received = MUTEX_INIT_LOCKED;
+static volatile unsigned _received;
+static unsigned _expected;
+static size_t _frame_len;
+
+static void _recv(netdev_t *dev)
+{
+    int size = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (size <= 0) {
+        return;
+    }
+    if (dev->driver->recv(dev, _rx_buf, sizeof(_rx_buf), NULL) != size) {
+        puts("error receiving frame");
+        return;
+    }
+    if (((size_t)size == _frame_len) &&
+        (memcmp(&_rx_buf[ETHERNET_ADDR_LEN * 2], &_tx_buf[ETHERNET_ADDR_LEN * 2],
+                sizeof(uint16_t)) == 0)) {
+        _received++;
+        if (_received == _expected) {
+            mutex_unlock(&_burst_received);
+        }
+    }
+}
+
+static void _event_cb(netdev_t *dev, netdev_event_t event)
+{
+    switch (event) {
+        case NETDEV_EVENT_ISR: {
+            msg_t msg = { .type = RX_MSG_TYPE_ISR, .content = { .ptr = dev } };
+
+            if (msg_send(&msg, _rx_pid) <= 0) {
+                puts("lost interrupt");
+            }
+            break;
+        }
+        case NETDEV_EVENT_RX_COMPLETE:
+            _recv(dev);
+            break;
+        default:
+            break;
+    }
+}
+
+static void *_rx_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_rx_queue, RX_MSG_QUEUE_SIZE);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == RX_MSG_TYPE_ISR) {
+            netdev_t *dev = msg.content.ptr;
+
+            dev->driver->isr(dev);
+        }
+    }
+    return NULL;
+}
+
+static void _bench(size_t frame_len)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_tx_buf;
+    iolist_t iolist = { .iol_base = _tx_buf, .iol_len = frame_len };
+    netdev_t *tx = &_tx_dev.netdev;
+    unsigned lost = 0;
+    uint32_t start, time;
+
+    memcpy(hdr->dst, _rx_dev.addr, ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _tx_dev.addr, ETHERNET_ADDR_LEN);
+    hdr->type = byteorder_htons(TEST_ETHERTYPE);
+    _frame_len = frame_len;
+    _received = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned sent = 0; sent < TEST_FRAMES; sent += TEST_BURST) {
+        /* a late frame of a previous burst may have unlocked the mutex */
+        mutex_trylock(&_burst_received);
+        _expected = _received + TEST_BURST;
+        for (unsigned i = 0; i < TEST_BURST; i++) {
+            tx->driver->send(tx, &iolist);
+        }
+        if (xtimer_mutex_lock_timeout(&_burst_received, TEST_TIMEOUT_US) < 0) {
+            lost += _expected - _received;
+        }
+    }
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"frame_len\" : %u, \"frames\" : %u, \"lost\" : %u, "
+           "\"frames_per_s\" : %lu }\n", (unsigned)frame_len, _received, lost,
+           (unsigned long)(((uint64_t)_received * US_PER_SEC) / time));
+}
+
+int main(void)
+{
+    static const size_t frame_lens[] = { 64, 512, ETHERNET_FRAME_LEN };
+
+    puts("netdev_tap receive benchmark");
+    printf("reception: %s\n", IS_USED(MODULE_NETDEV_TAP_BATCH) ? "batch"
+                                                                : "single");
+
+    netdev_tap_setup(&_tx_dev, &netdev_tap_params[0]);
+    netdev_tap_setup(&_rx_dev, &netdev_tap_params[1]);
+    /* frames to the sending interface are received, too, but not counted */
+    _tx_dev.netdev.event_callback = _event_cb;
+    _rx_dev.netdev.event_callback = _event_cb;
+    _rx_pid = thread_create(_rx_stack, sizeof(_rx_stack),
+                            THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                            _rx_thread, NULL, "rx");
+    if ((_tx_dev.netdev.driver->init(&_tx_dev.netdev) < 0) ||
+        (_rx_dev.netdev.driver->init(&_rx_dev.netdev) < 0)) {
+        puts("error initializing tap interfaces");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(frame_lens); i++) {
+        _bench(frame_lens[i]);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures wake-ups of select(), poll(), and epoll_wait() with a
+ *              growing number of idle sockets
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "kernel_defines.h"
+#include "xtimer.h"
+
+#ifndef TEST_ITERATIONS
+#define TEST_ITERATIONS     (1000U)
+#endif
+
+#define TEST_IDLE_MAX       (32U)
+#define TEST_PORT           (61616U)
+
+typedef enum {
+    API_SELECT,
+    API_POLL,
+    API_EPOLL,
+} api_t;
+
+static const char *_api_names[] = { "select", "poll", "epoll" };
+static const unsigned _idle_numof[] = { 0, 8, 16, 32 };
+
+static int _idle[TEST_IDLE_MAX];
+static int _sender;
+static int _active;
+static struct pollfd _pfds[TEST_IDLE_MAX + 1];
+
+static int _udp_socket(uint16_t port)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6 };
+    int fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (fd < 0) {
+        return -1;
+    }
+    addr.sin6_port = htons(port);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int _trigger(void)
+{
+    struct sockaddr_in6 dst = { .sin6_family = AF_INET6,
+                                .sin6_addr = IN6ADDR_LOOPBACK_INIT };
+    uint8_t byte = 0;
+
+    dst.sin6_port = htons(TEST_PORT);
+    return sendto(_sender, &byte, sizeof(byte), 0, (struct sockaddr *)&dst,
+                  sizeof(dst));
+}
+
+static int _wait_select(unsigned idle)
+{
+    fd_set readfds;
+
+    FD_ZERO(&readfds);
+    for (unsigned i = 0; i < idle; i++) {
+        FD_SET(_idle[i], &readfds);
+    }
+    FD_SET(_active, &readfds);
+    /* the active socket was created last, so it has the highest number */
+    if ((select(_active + 1, &readfds, NULL, NULL, NULL) != 1) ||
+        !FD_ISSET(_active, &readfds)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _wait_poll(unsigned idle)
+{
+    if ((poll(_pfds, idle + 1, -1) != 1) || !(_pfds[idle].revents & POLLIN)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _wait_epoll(int epfd)
+{
+    struct epoll_event event;
+
+    if ((epoll_wait(epfd, &event, 1, -1) != 1) ||
+        (event.data.fd != _active)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _setup(api_t api, unsigned idle)
+{
+    int epfd = 0;
+
+    switch (api) {
+        case API_POLL:
+            for (unsigned i = 0; i < idle; i++) {
+                _pfds[i].fd = _idle[i];
+                _pfds[i].events = POLLIN;
+            }
+            _pfds[idle].fd = _active;
+            _pfds[idle].events = POLLIN;
+            break;
+        case API_EPOLL:
+            if ((epfd = epoll_create1(0)) < 0) {
+                return -1;
+            }
+            for (unsigned i = 0; i <= idle; i++) {
+                struct epoll_event event = { .events = EPOLLIN };
+
+                event.data.fd = (i < idle) ? _idle[i] : _active;
+                if (epoll_ctl(epfd, EPOLL_CTL_ADD, event.data.fd,
+                              &event) < 0) {
+                    close(epfd);
+                    return -1;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    return epfd;
+}
+
+static int _bench(api_t api, unsigned idle)
+{
+    uint32_t start, time;
+    int epfd;
+
+    if ((epfd = _setup(api, idle)) < 0) {
+        puts("error: unable to set up file descriptors");
+        return -1;
+    }
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        uint8_t byte;
+        int res;
+
+        if (_trigger() < 0) {
+            puts("error: unable to send");
+            return -1;
+        }
+        switch (api) {
+            case API_SELECT:
+                res = _wait_select(idle);
+                break;
+            case API_POLL:
+                res = _wait_poll(idle);
+                break;
+            default:
+                res = _wait_epoll(epfd);
+                break;
+        }
+        if ((res < 0) || (recv(_active, &byte, sizeof(byte), 0) < 0)) {
+            printf("error: %s did not report active socket\n",
+                   _api_names[api]);
+            return -1;
+        }
+    }
+    time = xtimer_now_usec() - start;
+    if (api == API_EPOLL) {
+        close(epfd);
+    }
+
+    printf("{ \"api\" : \"%s\", \"sockets\" : %u, \"iterations\" : %u, "
+           "\"time_us\" : %lu, \"wakeups_per_s\" : %lu }\n",
+           _api_names[api], idle + 1, TEST_ITERATIONS, (unsigned long)time,
+           (unsigned long)(((uint64_t)TEST_ITERATIONS * US_PER_SEC) / time));
+    return 0;
+}
+
+int main(void)
+{
+    puts("POSIX poll benchmark");
+
+    for (unsigned i = 0; i < TEST_IDLE_MAX; i++) {
+        if ((_idle[i] = _udp_socket(TEST_PORT + 1 + i)) < 0) {
+            puts("error: unable to create idle socket");
+            return 1;
+        }
+    }
+    if (((_sender = _udp_socket(TEST_PORT - 1)) < 0) ||
+        ((_active = _udp_socket(TEST_PORT)) < 0)) {
+        puts("error: unable to create socket");
+        return 1;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_idle_numof); i++) {
+        for (api_t api = API_SELECT; api <= API_EPOLL; api++) {
+            if (_bench(api, _idle_numof[i]) < 0) {
+                return 1;
+            }
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+SOCKETS = (1, 9, 17, 33)
+APIS = ("select", "poll", "epoll")
+
+
+def testfunc(child):
+    child.expect_exact("POSIX poll benchmark")
+    for sockets in SOCKETS:
+        for api in APIS:
+            child.expect(r"{ \"api\" : \"(\w+)\", \"sockets\" : (\d+), "
+                         r"\"iterations\" : \d+, \"time_us\" : \d+, "
+                         r"\"wakeups_per_s\" : \d+ }")
+            assert child.match.group(1) == api
+            assert int(child.match.group(2)) == sockets
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
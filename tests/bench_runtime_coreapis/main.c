@@ -26,8 +26,17 @@
 #include "thread_flags.h"
 
 #ifndef BENCH_RUNS
-#define BENCH_RUNS          (1000UL * 1000UL)
+#define BENCH_RUNS          (1000UL)
 #endif
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES       (100U)
+#endif
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP        (10U)
+#endif
+
+#define BENCH(name, func)   BENCHMARK_SAMPLES(name, BENCH_WARMUP, \
+                                              BENCH_SAMPLES, BENCH_RUNS, func)
 
 static mutex_t _lock;
 static thread_t *t;
@@ -60,24 +69,21 @@ static void _flag_waitone(void)
 
 int main(void)
 {
-    puts("Runtime of Selected Core API functions\n");
+    puts("Runtime of Selected Core API functions");
 
     t = thread_get_active();
 
-    BENCHMARK_FUNC("nop loop", BENCH_RUNS, __asm__ volatile ("nop"));
-    puts("");
-    BENCHMARK_FUNC("mutex_init()", BENCH_RUNS, mutex_init(&_lock));
-    BENCHMARK_FUNC("mutex lock/unlock", BENCH_RUNS, _mutex_lockunlock());
-    puts("");
-    BENCHMARK_FUNC("thread_flags_set()", BENCH_RUNS, thread_flags_set(t, _flag));
-    BENCHMARK_FUNC("thread_flags_clear()", BENCH_RUNS, thread_flags_clear(_flag));
-    BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
-    BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
-    BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
-    puts("");
-    BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
-    BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
+    BENCH("nop loop", __asm__ volatile ("nop"));
+    BENCH("mutex_init()", mutex_init(&_lock));
+    BENCH("mutex lock/unlock", _mutex_lockunlock());
+    BENCH("thread_flags_set()", thread_flags_set(t, _flag));
+    BENCH("thread_flags_clear()", thread_flags_clear(_flag));
+    BENCH("thread flags set/wait any", _flag_waitany());
+    BENCH("thread flags set/wait all", _flag_waitall());
+    BENCH("thread flags set/wait one", _flag_waitone());
+    BENCH("msg_try_receive()", msg_try_receive(&_msg));
+    BENCH("msg_avail()", msg_avail());
 
-    puts("\n[SUCCESS]");
+    puts("[SUCCESS]");
     return 0;
 }
@@ -12,7 +12,10 @@ from testrunner import run
 
 # The default timeout is not enough for this test on some of the slower boards
 TIMEOUT = 30
-BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+BENCHMARK_REGEXP = r"{{ \"name\" : \"{func}\", \"unit\" : \"\w+\", " \
+                   r"\"runs\" : \d+, \"samples\" : \d+, \"min\" : \d+, " \
+                   r"\"median\" : \d+, \"p99\" : \d+, \"max\" : \d+, " \
+                   r"\"mean\" : \d+ }}"
 
 
 def testfunc(child):
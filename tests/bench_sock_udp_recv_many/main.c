@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures receiving bursts of UDP datagrams with
+ *              sock_udp_recv() and sock_udp_recv_many()
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/sock/udp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BATCH_MAX           (32U)
+#define DATAGRAM_MAX        (128U)
+/* the flood is over, when no datagram was received for this long */
+#define IDLE_TIMEOUT        (500U * US_PER_MS)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static sock_udp_t _sock;
+static uint8_t _bufs[BATCH_MAX][DATAGRAM_MAX];
+static sock_udp_mmsg_t _msgs[BATCH_MAX];
+
+static int _bench_cmd(int argc, char **argv)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    uint32_t start = 0, last = 0, timeout = SOCK_NO_TIMEOUT;
+    unsigned datagrams = 0, calls = 0, batch = 1;
+    int res;
+
+    if (argc < 2) {
+        printf("usage: %s <port> [<batch>]\n", argv[0]);
+        return 1;
+    }
+    local.port = atoi(argv[1]);
+    if (argc > 2) {
+        batch = atoi(argv[2]);
+    }
+    if ((batch == 0) || (batch > BATCH_MAX)) {
+        printf("batch must be between 1 and %u\n", BATCH_MAX);
+        return 1;
+    }
+    if (sock_udp_create(&_sock, &local, NULL, 0) < 0) {
+        puts("error creating sock");
+        return 1;
+    }
+    printf("listening on port %u\n", local.port);
+
+    while (1) {
+        if (batch == 1) {
+            res = sock_udp_recv(&_sock, _bufs[0], sizeof(_bufs[0]), timeout,
+                                NULL);
+            res = (res < 0) ? res : 1;
+        }
+        else {
+            for (unsigned i = 0; i < batch; i++) {
+                _msgs[i].data = _bufs[i];
+                _msgs[i].len = sizeof(_bufs[i]);
+                _msgs[i].remote = NULL;
+            }
+            res = sock_udp_recv_many(&_sock, _msgs, batch, timeout);
+        }
+        if (res == -ETIMEDOUT) {
+            break;
+        }
+        else if (res < 0) {
+            /* e.g. datagram too long, just skip it */
+            continue;
+        }
+        last = xtimer_now_usec();
+        if (datagrams == 0) {
+            start = last;
+            timeout = IDLE_TIMEOUT;
+        }
+        datagrams += res;
+        calls++;
+    }
+    sock_udp_close(&_sock);
+
+    printf("{ \"batch\" : %u, \"datagrams\" : %u, \"calls\" : %u, "
+           "\"time_us\" : %lu, \"datagrams_per_s\" : %lu }\n",
+           batch, datagrams, calls, (unsigned long)(last - start),
+           (last == start) ? 0UL
+           : (unsigned long)(((uint64_t)datagrams * US_PER_SEC) /
+                             (last - start)));
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "bench", "receive UDP datagrams and measure the rate", _bench_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("sock_udp receive batching benchmark");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import random
+import re
+import socket
+import sys
+
+from testrunner import run
+
+DATAGRAMS = 10000
+DATAGRAM_LEN = 64
+BATCHES = (1, 8, 32)
+
+
+def get_host_tap_device():
+    # Use bridge, if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    result = os.popen('bridge link show dev {}'.format(tap))
+    bridge = re.search('master (.*) state', result.read())
+
+    return bridge.group(1).strip() if bridge else tap
+
+
+def get_riot_ll_addr(child):
+    child.sendline('ifconfig')
+    child.expect(r'inet6 addr:\s+(fe80[0-9a-f:]+)\s')
+    return child.match.group(1).strip()
+
+
+def flood(addr, port):
+    payload = bytes(DATAGRAM_LEN)
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        dst = socket.getaddrinfo('{}%{}'.format(addr, get_host_tap_device()),
+                                 port, socket.AF_INET6,
+                                 socket.SOCK_DGRAM)[0][4]
+        for _ in range(DATAGRAMS):
+            sock.sendto(payload, dst)
+
+
+def testfunc(child):
+    child.expect_exact("sock_udp receive batching benchmark")
+    addr = get_riot_ll_addr(child)
+    for batch in BATCHES:
+        port = random.randint(1024, 65535)
+        child.sendline('bench {} {}'.format(port, batch))
+        child.expect_exact('listening on port {}'.format(port))
+        flood(addr, port)
+        child.expect(r"{ \"batch\" : (\d+), \"datagrams\" : (\d+), "
+                     r"\"calls\" : (\d+), \"time_us\" : \d+, "
+                     r"\"datagrams_per_s\" : \d+ }")
+        assert int(child.match.group(1)) == batch
+        # datagrams may be dropped when RIOT can't keep up
+        assert 0 < int(child.match.group(2)) <= DATAGRAMS
+        assert int(child.match.group(3)) <= int(child.match.group(2))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
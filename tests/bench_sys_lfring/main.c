@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the lock-free ringbuffer against the ringbuffers
+ *              disabling interrupts
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "lfring.h"
+#include "ringbuffer.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+#define TEST_BYTES      (64U * 1024U)
+#endif
+
+#define TEST_BUF_SIZE   (64U)
+#define TEST_BATCH      (16U)
+
+static char _buf[TEST_BUF_SIZE];
+static atomic_uint_least16_t _seqs[TEST_BUF_SIZE];
+static uint8_t _batch[TEST_BATCH];
+
+static ringbuffer_t _ringbuffer;
+static tsrb_t _tsrb;
+static lfring_t _lfring;
+static lfring_mpsc_t _lfring_mpsc;
+
+/* ringbuffer_t is not thread-safe itself, so disable interrupts like its
+ * users sharing it with an ISR have to */
+static int _ringbuffer_put(void)
+{
+    unsigned state = irq_disable();
+    int res = ringbuffer_add_one(&_ringbuffer, 0x5a);
+
+    irq_restore(state);
+    return res;
+}
+
+static int _ringbuffer_get(void)
+{
+    unsigned state = irq_disable();
+    int res = ringbuffer_get_one(&_ringbuffer);
+
+    irq_restore(state);
+    return (res < 0) ? -1 : 0;
+}
+
+static unsigned _ringbuffer_put_batch(void)
+{
+    unsigned state = irq_disable();
+    unsigned res = ringbuffer_add(&_ringbuffer, (char *)_batch,
+                                  sizeof(_batch));
+
+    irq_restore(state);
+    return res;
+}
+
+static unsigned _ringbuffer_get_batch(void)
+{
+    unsigned state = irq_disable();
+    unsigned res = ringbuffer_get(&_ringbuffer, (char *)_batch,
+                                  sizeof(_batch));
+
+    irq_restore(state);
+    return res;
+}
+
+static int _tsrb_put(void)
+{
+    return tsrb_add_one(&_tsrb, 0x5a);
+}
+
+static int _tsrb_get(void)
+{
+    return (tsrb_get_one(&_tsrb) < 0) ? -1 : 0;
+}
+
+static unsigned _tsrb_put_batch(void)
+{
+    return tsrb_add(&_tsrb, _batch, sizeof(_batch));
+}
+
+static unsigned _tsrb_get_batch(void)
+{
+    return tsrb_get(&_tsrb, _batch, sizeof(_batch));
+}
+
+static int _lfring_put(void)
+{
+    static const uint8_t byte = 0x5a;
+
+    return lfring_put(&_lfring, &byte);
+}
+
+static int _lfring_get(void)
+{
+    uint8_t byte;
+
+    return lfring_get(&_lfring, &byte);
+}
+
+static unsigned _lfring_put_batch(void)
+{
+    return lfring_put_many(&_lfring, _batch, sizeof(_batch));
+}
+
+static unsigned _lfring_get_batch(void)
+{
+    return lfring_get_many(&_lfring, _batch, sizeof(_batch));
+}
+
+static int _lfring_mpsc_put(void)
+{
+    static const uint8_t byte = 0x5a;
+
+    return lfring_mpsc_put(&_lfring_mpsc, &byte);
+}
+
+static int _lfring_mpsc_get(void)
+{
+    uint8_t byte;
+
+    return lfring_mpsc_get(&_lfring_mpsc, &byte);
+}
+
+static void _print(const char *impl, unsigned batch, uint32_t time)
+{
+    printf("{ \"impl\" : \"%s\", \"batch\" : %u, \"bytes\" : %u, "
+           "\"time_us\" : %lu, \"bytes_per_s\" : %lu }\n",
+           impl, batch, TEST_BYTES, (unsigned long)time,
+           (unsigned long)(((uint64_t)TEST_BYTES * US_PER_SEC) / time));
+}
+
+/* puts bytes until the buffer is full and then gets them all again to
+ * include the full checks */
+static int _bench_one(const char *impl, int (*put)(void), int (*get)(void))
+{
+    uint32_t start, time;
+    unsigned bytes = 0;
+
+    start = xtimer_now_usec();
+    while (bytes < TEST_BYTES) {
+        while (put() == 0) {}
+        while (get() == 0) {
+            bytes++;
+        }
+    }
+    time = xtimer_now_usec() - start;
+    if (bytes != TEST_BYTES) {
+        printf("error: %s lost bytes\n", impl);
+        return -1;
+    }
+    _print(impl, 1, time);
+    return 0;
+}
+
+static int _bench_batch(const char *impl, unsigned (*put)(void),
+                        unsigned (*get)(void))
+{
+    uint32_t start, time;
+    unsigned bytes = 0;
+
+    start = xtimer_now_usec();
+    while (bytes < TEST_BYTES) {
+        while (put() == TEST_BATCH) {}
+        for (unsigned res; (res = get()) > 0;) {
+            bytes += res;
+        }
+    }
+    time = xtimer_now_usec() - start;
+    if (bytes != TEST_BYTES) {
+        printf("error: %s lost bytes\n", impl);
+        return -1;
+    }
+    _print(impl, TEST_BATCH, time);
+    return 0;
+}
+
+int main(void)
+{
+    /* TEST_BYTES must be a multiple of the buffer size for the byte count
+     * check */
+    static_assert((TEST_BYTES % TEST_BUF_SIZE) == 0,
+                  "TEST_BYTES must be a multiple of TEST_BUF_SIZE");
+
+    puts("Ringbuffer benchmark");
+
+    ringbuffer_init(&_ringbuffer, _buf, sizeof(_buf));
+    tsrb_init(&_tsrb, (uint8_t *)_buf, sizeof(_buf));
+    lfring_init(&_lfring, _buf, 1, sizeof(_buf));
+    lfring_mpsc_init(&_lfring_mpsc, _buf, _seqs, 1, sizeof(_buf));
+    if ((_bench_one("ringbuffer", _ringbuffer_put, _ringbuffer_get) < 0) ||
+        (_bench_one("tsrb", _tsrb_put, _tsrb_get) < 0) ||
+        (_bench_one("lfring", _lfring_put, _lfring_get) < 0) ||
+        (_bench_one("lfring_mpsc", _lfring_mpsc_put, _lfring_mpsc_get) < 0) ||
+        (_bench_batch("ringbuffer", _ringbuffer_put_batch,
+                      _ringbuffer_get_batch) < 0) ||
+        (_bench_batch("tsrb", _tsrb_put_batch, _tsrb_get_batch) < 0) ||
+        (_bench_batch("lfring", _lfring_put_batch, _lfring_get_batch) < 0)) {
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
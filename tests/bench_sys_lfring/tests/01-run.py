@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULTS = (
+    ("ringbuffer", 1), ("tsrb", 1), ("lfring", 1), ("lfring_mpsc", 1),
+    ("ringbuffer", 16), ("tsrb", 16), ("lfring", 16),
+)
+
+
+def testfunc(child):
+    child.expect_exact("Ringbuffer benchmark")
+    for impl, batch in RESULTS:
+        child.expect(r"{ \"impl\" : \"(\w+)\", \"batch\" : (\d+), "
+                     r"\"bytes\" : \d+, \"time_us\" : \d+, "
+                     r"\"bytes_per_s\" : \d+ }")
+        assert child.match.group(1) == impl
+        assert int(child.match.group(2)) == batch
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
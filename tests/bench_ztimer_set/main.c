@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure ztimer_set() / ztimer_remove() against the number of
+ *              active timers
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+
+#include "random.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#ifndef TEST_TIMER_NUMOF
+#define TEST_TIMER_NUMOF    (256U)
+#endif
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT         (1000U)
+#endif
+
+/* maximum offset a timer gets set to */
+#define TEST_OFFSET_MAX     (1000000UL)
+
+static ztimer_mock_t _mock;
+static ztimer_t _timers[TEST_TIMER_NUMOF];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+}
+
+static ztimer_t *_random_timer(unsigned numof)
+{
+    return &_timers[random_uint32_range(0, numof)];
+}
+
+static void _bench(unsigned numof)
+{
+    ztimer_clock_t *clock = &_mock.super;
+    uint32_t start, time_set, time_remove;
+    uint32_t max_set = 0;
+    uint32_t max_remove = 0;
+
+    ztimer_mock_init(&_mock, 32);
+
+    for (unsigned i = 0; i < numof; i++) {
+        _timers[i].callback = _cb;
+        ztimer_set(clock, &_timers[i],
+                   random_uint32_range(1, TEST_OFFSET_MAX));
+    }
+
+    /* average: time whole loops to not be limited by the clock resolution */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        ztimer_set(clock, _random_timer(numof),
+                   random_uint32_range(1, TEST_OFFSET_MAX));
+    }
+    time_set = ztimer_now(ZTIMER_USEC) - start;
+
+    time_remove = 0;
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        ztimer_t *timer = _random_timer(numof);
+
+        start = ztimer_now(ZTIMER_USEC);
+        ztimer_remove(clock, timer);
+        time_remove += ztimer_now(ZTIMER_USEC) - start;
+        ztimer_set(clock, timer, random_uint32_range(1, TEST_OFFSET_MAX));
+    }
+
+    /* worst case of single calls */
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        ztimer_t *timer = _random_timer(numof);
+        uint32_t diff;
+
+        start = ztimer_now(ZTIMER_USEC);
+        ztimer_remove(clock, timer);
+        diff = ztimer_now(ZTIMER_USEC) - start;
+        if (diff > max_remove) {
+            max_remove = diff;
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        ztimer_set(clock, timer, random_uint32_range(1, TEST_OFFSET_MAX));
+        diff = ztimer_now(ZTIMER_USEC) - start;
+        if (diff > max_set) {
+            max_set = diff;
+        }
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_remove(clock, &_timers[i]);
+    }
+
+    printf("{ \"timers\" : %u, \"set_avg_ns\" : %lu, \"set_max_us\" : %lu, "
+           "\"remove_avg_ns\" : %lu, \"remove_max_us\" : %lu }\n",
+           numof,
+           (unsigned long)(((uint64_t)time_set * 1000) / TEST_REPEAT),
+           (unsigned long)max_set,
+           (unsigned long)(((uint64_t)time_remove * 1000) / TEST_REPEAT),
+           (unsigned long)max_remove);
+}
+
+int main(void)
+{
+    puts("ztimer_set() / ztimer_remove() benchmark");
+    printf("implementation: %s\n", IS_USED(MODULE_ZTIMER_HEAP) ? "heap"
+                                                                 : "list");
+
+    for (unsigned numof = 1; numof <= TEST_TIMER_NUMOF; numof *= 4) {
+        _bench(numof);
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
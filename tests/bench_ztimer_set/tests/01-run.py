@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("ztimer_set() / ztimer_remove() benchmark")
+    child.expect(r"implementation: (list|heap)")
+    child.expect(r"{ \"timers\" : \d+, \"set_avg_ns\" : \d+, "
+                 r"\"set_max_us\" : \d+, \"remove_avg_ns\" : \d+, "
+                 r"\"remove_max_us\" : \d+ }")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
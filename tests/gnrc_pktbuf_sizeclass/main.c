@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the size-class packet buffer implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "embUnit.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#define MIN_BLOCK       (1U << CONFIG_GNRC_PKTBUF_SIZECLASS_MIN_EXP)
+#define POOL_SIZE       ((CONFIG_GNRC_PKTBUF_SIZE / MIN_BLOCK) * MIN_BLOCK)
+/* largest power of two in the pool */
+#define MAX_BLOCK       (1U << bitarithm_msb(POOL_SIZE))
+#define TEST_STRING     "0123456789abcdefghijklmnopqrstuvwxyz"
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static void test_sizeclass_init(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_sizeclass_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, MAX_BLOCK + 1,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_sizeclass_add__largest(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, MAX_BLOCK,
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_sizeclass_add__fill_and_merge(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    unsigned count = 0;
+
+    /* fill the pool with smallest blocks (chained to one packet) */
+    for (unsigned i = 0; i < (POOL_SIZE / MIN_BLOCK); i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST);
+
+        if (tmp == NULL) {
+            /* ran out of snip headers before running out of data */
+            break;
+        }
+        pkt = tmp;
+        count++;
+    }
+    TEST_ASSERT(count > 0);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* all buddies must be merged again on release */
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt = gnrc_pktbuf_add(NULL, NULL, MAX_BLOCK, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_sizeclass_add__snips_exhausted(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, 0, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(pkt, NULL, 0, GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_sizeclass_mark(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 10, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT_EQUAL_INT(10, hdr->size);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING) - 10, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING, hdr->data, 10));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING + 10, pkt->data, pkt->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* remainder points into its original block, it must still be released */
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_sizeclass_realloc_data__grow_in_place(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING, MIN_BLOCK - 4,
+                                          GNRC_NETTYPE_TEST);
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, MIN_BLOCK));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, MIN_BLOCK + 1));
+    TEST_ASSERT(data != pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING, pkt->data, MIN_BLOCK - 4));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_sizeclass_realloc_data__shrink(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2, *rest = NULL;
+
+    /* occupy the whole pool: the largest block and the tiles after it */
+    pkt1 = gnrc_pktbuf_add(NULL, NULL, MAX_BLOCK, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt1);
+    for (unsigned size = MAX_BLOCK / 2; size >= MIN_BLOCK; size /= 2) {
+        if (POOL_SIZE & size) {
+            pkt2 = gnrc_pktbuf_add(rest, NULL, size, GNRC_NETTYPE_TEST);
+            TEST_ASSERT_NOT_NULL(pkt2);
+            rest = pkt2;
+        }
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, 1, GNRC_NETTYPE_TEST));
+    /* shrinking returns the unused upper part of the block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt1, MIN_BLOCK));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt2 = gnrc_pktbuf_add(NULL, NULL, MAX_BLOCK / 2, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt2);
+    gnrc_pktbuf_release(pkt1);
+    if (rest != NULL) {
+        gnrc_pktbuf_release(rest);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static Test *tests_gnrc_pktbuf_sizeclass(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sizeclass_init),
+        new_TestFixture(test_sizeclass_add__too_large),
+        new_TestFixture(test_sizeclass_add__largest),
+        new_TestFixture(test_sizeclass_add__fill_and_merge),
+        new_TestFixture(test_sizeclass_add__snips_exhausted),
+        new_TestFixture(test_sizeclass_mark),
+        new_TestFixture(test_sizeclass_realloc_data__grow_in_place),
+        new_TestFixture(test_sizeclass_realloc_data__shrink),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_sizeclass());
+    TESTS_END();
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+
+    return 0;
+}
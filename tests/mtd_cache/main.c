@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd that counts its
+ * accesses */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 8
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+#ifndef CACHE_LINES
+#define CACHE_LINES 4
+#endif
+
+#define MEMORY_SIZE         PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT
+#define SECTOR_SIZE         PAGE_SIZE * PAGE_PER_SECTOR
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static unsigned _reads, _writes, _erases;
+
+static uint8_t _buffer[2 * PAGE_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    _reads++;
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    if (offset > dev->page_size) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+    _writes++;
+    memcpy(_dummy_memory + addr, buff, size);
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    _erases++;
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static int _power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void)dev;
+    (void)power;
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .power = _power,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * PAGE_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&dev, _lines, _cache_buf);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < MEMORY_SIZE; i++) {
+        _dummy_memory[i] = i / PAGE_SIZE;
+    }
+    /* starts with an empty cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    _reads = 0;
+    _writes = 0;
+    _erases = 0;
+}
+
+static void test_mtd_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_read_hit(void)
+{
+    /* small reads of the same page load it once */
+    for (unsigned i = 0; i < PAGE_SIZE; i += 8) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 5 * PAGE_SIZE + i, 8));
+        _test_mem(_buffer, 8, 5);
+    }
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE / 8 - 1, _cache.stats.hits);
+
+    mtd_cache_stats_reset(&_cache);
+    TEST_ASSERT_EQUAL_INT(0, _cache.stats.hits);
+}
+
+static void test_mtd_read_ahead(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, 1));
+    /* random access, no read-ahead */
+    TEST_ASSERT_EQUAL_INT(0, _cache.stats.read_ahead);
+    /* sequential access loads the following page with the same read */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.read_ahead);
+    TEST_ASSERT_EQUAL_INT(2, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 2 * PAGE_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(2, _reads);
+    _test_mem(_buffer, 1, 2);
+    TEST_ASSERT_EQUAL_INT(2, _cache.stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.hits);
+}
+
+static void test_mtd_read_across_pages(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 3 * PAGE_SIZE + 10,
+                                      PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE - 10, 3);
+    _test_mem(_buffer + PAGE_SIZE - 10, 10, 4);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_read(_dev, _buffer,
+                                               MEMORY_SIZE - 1, 2));
+}
+
+static void test_mtd_write_coalesce(void)
+{
+    memset(_buffer, 0xaa, PAGE_SIZE);
+    /* small writes only change the cache */
+    for (unsigned i = 0; i < PAGE_SIZE; i += 16) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 6 * PAGE_SIZE + i, 16));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    /* only the first write loaded the page */
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 6 * PAGE_SIZE, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xaa);
+    _test_mem(&_dummy_memory[6 * PAGE_SIZE], PAGE_SIZE, 6);
+
+    /* and go to the device in one piece */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.write_backs);
+    _test_mem(&_dummy_memory[6 * PAGE_SIZE], PAGE_SIZE, 0xaa);
+
+    /* nothing left to write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+}
+
+static void test_mtd_write_full_page(void)
+{
+    memset(_buffer, 0xbb, 2 * PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 8, 0, 2 * PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, _reads);
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    _test_mem(&_dummy_memory[8 * PAGE_SIZE], 2 * PAGE_SIZE, 0xbb);
+}
+
+static void test_mtd_write_evict(void)
+{
+    memset(_buffer, 0xcc, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 10, 1));
+    /* fills the other lines, pages 20 and up are no read-ahead candidates */
+    for (unsigned i = 0; i < CACHE_LINES - 1; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, (20 + 2 * i) * PAGE_SIZE, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    /* the written page is the least recently used one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 30 * PAGE_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(0xcc, _dummy_memory[10]);
+    TEST_ASSERT_EQUAL_INT(0, _dummy_memory[11]);
+}
+
+static void test_mtd_erase(void)
+{
+    memset(_buffer, 0xdd, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 2 * SECTOR_SIZE, PAGE_SIZE));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(_dev, SECTOR_SIZE, 2 * SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+
+    /* the pending write is dropped, the cached page reloaded */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 2 * SECTOR_SIZE, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase_sector(_dev, SECTOR_COUNT - 1, 2));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_read_hit),
+        new_TestFixture(test_mtd_read_ahead),
+        new_TestFixture(test_mtd_read_across_pages),
+        new_TestFixture(test_mtd_write_coalesce),
+        new_TestFixture(test_mtd_write_full_page),
+        new_TestFixture(test_mtd_write_evict),
+        new_TestFixture(test_mtd_erase),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
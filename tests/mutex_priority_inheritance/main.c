@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the priority inheritance of mutexes
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+#define PRIO_LOW                (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID                (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH               (THREAD_PRIORITY_MAIN - 3)
+
+enum {
+    EVENT_LOW_UNLOCKING,
+    EVENT_HIGH_LOCKED,
+    EVENT_MID_RUNNING,
+    EVENT_LOW_UNLOCKED_OUTER,
+    EVENT_MID_LOCKED,
+    EVENT_NUMOF,
+};
+
+static char stack_low[THREAD_STACKSIZE_MAIN];
+static char stack_mid[THREAD_STACKSIZE_MAIN];
+static char stack_high[THREAD_STACKSIZE_MAIN];
+
+static kernel_pid_t pid_mid;
+static kernel_pid_t pid_high;
+
+static mutex_t testlock = MUTEX_INIT;
+static mutex_t outer = MUTEX_INIT;
+static mutex_t inner = MUTEX_INIT;
+
+static unsigned events[EVENT_NUMOF];
+static unsigned events_numof;
+static unsigned low_prio_locked;
+static unsigned low_prio_unlocking;
+static unsigned low_prio_unlocked;
+
+static void event(unsigned e)
+{
+    events[events_numof++] = e;
+}
+
+static unsigned prio(void)
+{
+    return thread_get_active()->priority;
+}
+
+static void *high(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&testlock);
+    event(EVENT_HIGH_LOCKED);
+    puts("high: locked mutex");
+    mutex_unlock(&testlock);
+
+    return NULL;
+}
+
+static void *mid(void *arg)
+{
+    (void)arg;
+
+    event(EVENT_MID_RUNNING);
+    puts("mid: running");
+
+    return NULL;
+}
+
+static void *low(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&testlock);
+    low_prio_locked = prio();
+    printf("low: locked mutex (prio %u)\n", low_prio_locked);
+    /* high blocks on the mutex */
+    thread_wakeup(pid_high);
+    /* without priority inheritance, mid preempts low (and high) */
+    thread_wakeup(pid_mid);
+    low_prio_unlocking = prio();
+    event(EVENT_LOW_UNLOCKING);
+    printf("low: unlocking mutex (prio %u)\n", low_prio_unlocking);
+    mutex_unlock(&testlock);
+    low_prio_unlocked = prio();
+    printf("low: unlocked mutex (prio %u)\n", low_prio_unlocked);
+
+    return NULL;
+}
+
+static void *high_nested(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&inner);
+    event(EVENT_HIGH_LOCKED);
+    puts("high: locked inner mutex");
+    mutex_unlock(&inner);
+
+    return NULL;
+}
+
+static void *mid_nested(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&outer);
+    event(EVENT_MID_LOCKED);
+    puts("mid: locked outer mutex");
+    mutex_unlock(&outer);
+
+    return NULL;
+}
+
+static void *low_nested(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&outer);
+    mutex_lock(&inner);
+    /* mid blocks on the outer mutex, then high on the inner one */
+    thread_wakeup(pid_mid);
+    thread_wakeup(pid_high);
+    low_prio_unlocking = prio();
+    printf("low: locked both mutexes (prio %u)\n", low_prio_unlocking);
+    /* release out of order: high still waits for the inner mutex, so low
+     * must keep its priority and mid must not get the outer mutex yet */
+    mutex_unlock(&outer);
+    low_prio_locked = prio();
+    event(EVENT_LOW_UNLOCKED_OUTER);
+    printf("low: unlocked outer mutex (prio %u)\n", low_prio_locked);
+    mutex_unlock(&inner);
+    low_prio_unlocked = prio();
+    printf("low: unlocked inner mutex (prio %u)\n", low_prio_unlocked);
+
+    return NULL;
+}
+
+static void reset(void)
+{
+    events_numof = 0;
+    low_prio_locked = 0;
+    low_prio_unlocking = 0;
+    low_prio_unlocked = 0;
+}
+
+static bool test_single(void)
+{
+    reset();
+    pid_high = thread_create(stack_high, sizeof(stack_high), PRIO_HIGH,
+                             THREAD_CREATE_SLEEPING, high, NULL, "high");
+    pid_mid = thread_create(stack_mid, sizeof(stack_mid), PRIO_MID,
+                            THREAD_CREATE_SLEEPING, mid, NULL, "mid");
+    /* runs right away, main continues once all threads are done */
+    thread_create(stack_low, sizeof(stack_low), PRIO_LOW, 0, low, NULL, "low");
+
+    return (events_numof == 3) &&
+           (events[0] == EVENT_LOW_UNLOCKING) &&
+           (events[1] == EVENT_HIGH_LOCKED) &&
+           (events[2] == EVENT_MID_RUNNING) &&
+           (low_prio_locked == PRIO_LOW) &&
+           (low_prio_unlocking == PRIO_HIGH) &&
+           (low_prio_unlocked == PRIO_LOW);
+}
+
+static bool test_nested(void)
+{
+    reset();
+    pid_high = thread_create(stack_high, sizeof(stack_high), PRIO_HIGH,
+                             THREAD_CREATE_SLEEPING, high_nested, NULL, "high");
+    pid_mid = thread_create(stack_mid, sizeof(stack_mid), PRIO_MID,
+                            THREAD_CREATE_SLEEPING, mid_nested, NULL, "mid");
+    thread_create(stack_low, sizeof(stack_low), PRIO_LOW, 0, low_nested, NULL,
+                  "low");
+
+    return (events_numof == 3) &&
+           (events[0] == EVENT_LOW_UNLOCKED_OUTER) &&
+           (events[1] == EVENT_HIGH_LOCKED) &&
+           (events[2] == EVENT_MID_LOCKED) &&
+           (low_prio_unlocking == PRIO_HIGH) &&
+           (low_prio_locked == PRIO_HIGH) &&
+           (low_prio_unlocked == PRIO_LOW);
+}
+
+int main(void)
+{
+    puts("Mutex priority inheritance test");
+
+    /* the threads of a test have finished when main gets to run again */
+    bool success = test_single();
+
+    success = test_nested() && success;
+
+    puts(success ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
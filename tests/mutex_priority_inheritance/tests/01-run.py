@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"low: locked mutex \(prio (\d+)\)")
+    low_prio = int(child.match.group(1))
+    child.expect(r"low: unlocking mutex \(prio (\d+)\)")
+    assert int(child.match.group(1)) < low_prio
+    child.expect_exact("high: locked mutex")
+    child.expect_exact("mid: running")
+    child.expect(r"low: unlocked mutex \(prio (\d+)\)")
+    assert int(child.match.group(1)) == low_prio
+    # nested mutexes released out of order
+    child.expect(r"low: locked both mutexes \(prio (\d+)\)")
+    high_prio = int(child.match.group(1))
+    assert high_prio < low_prio
+    child.expect(r"low: unlocked outer mutex \(prio (\d+)\)")
+    assert int(child.match.group(1)) == high_prio
+    child.expect_exact("high: locked inner mutex")
+    child.expect_exact("mid: locked outer mutex")
+    child.expect(r"low: unlocked inner mutex \(prio (\d+)\)")
+    assert int(child.match.group(1)) == low_prio
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
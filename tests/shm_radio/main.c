@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests and measures the shared memory radio
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "mutex.h"
+#include "net/ieee802154.h"
+#include "net/netdev.h"
+#include "shm_radio.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_FRAMES
+#define TEST_FRAMES         (4096U)
+#endif
+
+#ifndef TEST_BURST
+#define TEST_BURST          (32U)
+#endif
+
+#define TEST_MEDIUM         "/dev/shm/riot_shm_radio_test"
+#define TEST_OTHER_CHANNEL  (CONFIG_IEEE802154_DEFAULT_CHANNEL + 1)
+#define TEST_RADIOS         (3U)
+
+/* time to wait for frames */
+#define TEST_TIMEOUT_US     (100U * US_PER_MS)
+
+#define RX_MSG_QUEUE_SIZE   (8U)
+#define RX_MSG_TYPE_ISR     (0x3456)
+
+static const shm_radio_params_t _params = { .medium = TEST_MEDIUM };
+static shm_radio_t _radios[TEST_RADIOS];
+static unsigned _received[TEST_RADIOS];
+
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _rx_queue[RX_MSG_QUEUE_SIZE];
+static kernel_pid_t _rx_pid;
+
+static uint8_t _tx_buf[IEEE802154_FRAME_LEN_MAX];
+static uint8_t _rx_buf[IEEE802154_FRAME_LEN_MAX];
+static size_t _tx_len;
+
+static mutex_t _frames_received = MUTEX_INIT_LOCKED;
+static unsigned _expected;
+
+static void _recv(netdev_t *dev)
+{
+    unsigned idx = (shm_radio_t *)dev - _radios;
+    int size = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (size <= 0) {
+        return;
+    }
+    if (dev->driver->recv(dev, _rx_buf, sizeof(_rx_buf), NULL) != size) {
+        puts("error receiving frame");
+        return;
+    }
+    if (((size_t)size == _tx_len) && (memcmp(_rx_buf, _tx_buf, size) == 0)) {
+        _received[idx]++;
+        if (_received[idx] == _expected) {
+            mutex_unlock(&_frames_received);
+        }
+    }
+}
+
+static void _event_cb(netdev_t *dev, netdev_event_t event)
+{
+    switch (event) {
+        case NETDEV_EVENT_ISR: {
+            msg_t msg = { .type = RX_MSG_TYPE_ISR, .content = { .ptr = dev } };
+
+            if (msg_send(&msg, _rx_pid) <= 0) {
+                puts("lost interrupt");
+            }
+            break;
+        }
+        case NETDEV_EVENT_RX_COMPLETE:
+            _recv(dev);
+            break;
+        default:
+            break;
+    }
+}
+
+static void *_rx_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_rx_queue, RX_MSG_QUEUE_SIZE);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == RX_MSG_TYPE_ISR) {
+            netdev_t *dev = msg.content.ptr;
+
+            dev->driver->isr(dev);
+        }
+    }
+    return NULL;
+}
+
+static void _build_frame(const uint8_t *dst, size_t dst_len, size_t len)
+{
+    static uint8_t seq;
+    const le_uint16_t pan = byteorder_htols(CONFIG_IEEE802154_DEFAULT_PANID);
+    netdev_ieee802154_t *src = &_radios[0].netdev;
+    size_t hdr_len;
+
+    hdr_len = ieee802154_set_frame_hdr(_tx_buf, src->long_addr,
+                                       sizeof(src->long_addr), dst, dst_len,
+                                       pan, pan, IEEE802154_FCF_TYPE_DATA,
+                                       seq++);
+    for (unsigned i = hdr_len; i < len; i++) {
+        _tx_buf[i] = i;
+    }
+    _tx_len = len;
+}
+
+static int _send(unsigned frames)
+{
+    netdev_t *tx = &_radios[0].netdev.netdev;
+    iolist_t iolist = { .iol_base = _tx_buf, .iol_len = _tx_len };
+
+    for (unsigned i = 0; i < frames; i++) {
+        if (tx->driver->send(tx, &iolist) != (int)_tx_len) {
+            puts("error sending frame");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _reset_received(void)
+{
+    /* a late frame may have unlocked the mutex */
+    mutex_trylock(&_frames_received);
+    memset(_received, 0, sizeof(_received));
+}
+
+static int _test_broadcast(void)
+{
+    const uint16_t chan = TEST_OTHER_CHANNEL;
+    netdev_t *dev = &_radios[2].netdev.netdev;
+
+    dev->driver->set(dev, NETOPT_CHANNEL, &chan, sizeof(chan));
+    _build_frame(ieee802154_addr_bcast, sizeof(ieee802154_addr_bcast), 32);
+    _reset_received();
+    _expected = 1;
+    if (_send(1) < 0) {
+        return -1;
+    }
+    if (xtimer_mutex_lock_timeout(&_frames_received, TEST_TIMEOUT_US) < 0) {
+        puts("broadcast: not received");
+        return -1;
+    }
+    /* give the other radios time to receive the frame, if they do */
+    xtimer_usleep(TEST_TIMEOUT_US);
+    if ((_received[0] != 0) || (_received[1] != 1) || (_received[2] != 0)) {
+        printf("broadcast: received %u, %u, %u frames\n",
+               _received[0], _received[1], _received[2]);
+        return -1;
+    }
+    puts("broadcast: OK");
+    return 0;
+}
+
+static int _test_unicast(void)
+{
+    const uint16_t chan = CONFIG_IEEE802154_DEFAULT_CHANNEL;
+    netdev_t *dev = &_radios[2].netdev.netdev;
+
+    dev->driver->set(dev, NETOPT_CHANNEL, &chan, sizeof(chan));
+    _build_frame(_radios[2].netdev.long_addr,
+                 sizeof(_radios[2].netdev.long_addr), 48);
+    _reset_received();
+    _expected = 1;
+    if (_send(1) < 0) {
+        return -1;
+    }
+    if (xtimer_mutex_lock_timeout(&_frames_received, TEST_TIMEOUT_US) < 0) {
+        puts("unicast: not received");
+        return -1;
+    }
+    xtimer_usleep(TEST_TIMEOUT_US);
+    if ((_received[0] != 0) || (_received[1] != 0) || (_received[2] != 1)) {
+        printf("unicast: received %u, %u, %u frames\n",
+               _received[0], _received[1], _received[2]);
+        return -1;
+    }
+    puts("unicast: OK");
+    return 0;
+}
+
+static int _bench(size_t frame_len)
+{
+    unsigned lost = 0;
+    uint32_t start, time;
+
+    /* only the second radio receives unicasts to it */
+    _build_frame(_radios[1].netdev.long_addr,
+                 sizeof(_radios[1].netdev.long_addr), frame_len);
+    _reset_received();
+
+    start = xtimer_now_usec();
+    for (unsigned sent = 0; sent < TEST_FRAMES; sent += TEST_BURST) {
+        mutex_trylock(&_frames_received);
+        _expected = _received[1] + TEST_BURST;
+        if (_send(TEST_BURST) < 0) {
+            return -1;
+        }
+        if (xtimer_mutex_lock_timeout(&_frames_received, TEST_TIMEOUT_US) < 0) {
+            lost += _expected - _received[1];
+        }
+    }
+    time = xtimer_now_usec() - start;
+
+    printf("{ \"frame_len\" : %u, \"frames\" : %u, \"lost\" : %u, "
+           "\"frames_per_s\" : %lu }\n", (unsigned)frame_len, _received[1],
+           lost, (unsigned long)(((uint64_t)_received[1] * US_PER_SEC) / time));
+    return 0;
+}
+
+int main(void)
+{
+    static const size_t frame_lens[] = {
+        32, 64, IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN
+    };
+
+    puts("shm_radio test");
+
+    _rx_pid = thread_create(_rx_stack, sizeof(_rx_stack),
+                            THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                            _rx_thread, NULL, "rx");
+    for (unsigned i = 0; i < TEST_RADIOS; i++) {
+        netdev_t *dev = &_radios[i].netdev.netdev;
+
+        shm_radio_setup(&_radios[i], &_params);
+        dev->event_callback = _event_cb;
+        if (dev->driver->init(dev) < 0) {
+            puts("error initializing radio");
+            return 1;
+        }
+    }
+
+    if ((_test_broadcast() < 0) || (_test_unicast() < 0)) {
+        return 1;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(frame_lens); i++) {
+        if (_bench(frame_lens[i]) < 0) {
+            return 1;
+        }
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("shm_radio test")
+    child.expect_exact("broadcast: OK")
+    child.expect_exact("unicast: OK")
+    child.expect(r"{ \"frame_len\" : \d+, \"frames\" : \d+, \"lost\" : 0, "
+                 r"\"frames_per_s\" : \d+ }")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -76,10 +76,44 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+static void test_crypto_chacha20poly1305_iolist(void)
+{
+    uint8_t tag[CHACHA20POLY1305_TAG_BYTES];
+    /* split at odd offsets, so no entry is aligned to a block */
+    iolist_t data[] = {
+        { .iol_next = &data[1], .iol_base = ebuf, .iol_len = 1 },
+        { .iol_next = &data[2], .iol_base = ebuf + 1, .iol_len = 0 },
+        { .iol_next = &data[3], .iol_base = ebuf + 1, .iol_len = 70 },
+        { .iol_next = NULL, .iol_base = ebuf + 71,
+          .iol_len = sizeof(msg_1) - 71 },
+    };
+    iolist_t aad[] = {
+        { .iol_next = &aad[1], .iol_base = (uint8_t *)aad_1, .iol_len = 5 },
+        { .iol_next = NULL, .iol_base = (uint8_t *)aad_1 + 5,
+          .iol_len = sizeof(aad_1) - 5 },
+    };
+
+    memcpy(ebuf, msg_1, sizeof(msg_1));
+    chacha20poly1305_encrypt_iolist(data, aad, key_1, nonce_1, tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext_1, sizeof(msg_1)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(tag, ciphertext_1 + sizeof(msg_1),
+                                    sizeof(tag)));
+
+    tag[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(0,
+            chacha20poly1305_decrypt_iolist(data, aad, key_1, nonce_1, tag));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext_1, sizeof(msg_1)));
+    tag[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(1,
+            chacha20poly1305_decrypt_iolist(data, aad, key_1, nonce_1, tag));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, msg_1, sizeof(msg_1)));
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_iolist),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
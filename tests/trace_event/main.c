@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the binary event trace
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "msg.h"
+#include "trace_event.h"
+
+#define TEST_MSG_TYPE   (0x1234)
+#define TEST_USER_ARG0  (0xbeefcafe)
+#define TEST_USER_ARG1  (0xdeadc0de)
+
+static msg_t _queue[2];
+
+int main(void)
+{
+    msg_t msg = { .type = TEST_MSG_TYPE };
+
+    msg_init_queue(_queue, ARRAY_SIZE(_queue));
+    trace_event_reset();
+    msg_send_to_self(&msg);
+    msg_receive(&msg);
+    TRACE_EVENT(TRACE_EVENT_USER, TEST_USER_ARG0, TEST_USER_ARG1);
+
+    trace_event_dump();
+
+    return 0;
+}
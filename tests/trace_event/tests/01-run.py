@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import struct
+import sys
+from testrunner import run
+
+TRACE_EVENT_MSG_SEND = 1
+TRACE_EVENT_MSG_RECV = 2
+TRACE_EVENT_USER = 9
+EXPECTED = (
+    (TRACE_EVENT_MSG_SEND, 0x1234),
+    (TRACE_EVENT_MSG_RECV, 0x1234),
+    (TRACE_EVENT_USER, 0xbeefcafe, 0xdeadc0de),
+)
+
+
+def testfunc(child):
+    child.expect(r"trace_event begin version=2 events=(\d+) lost=0\r\n")
+    events = int(child.match.group(1))
+    found = []
+    for _ in range(events):
+        child.expect(r"([0-9a-f]{32})\r\n")
+        _, type_, event_pid, arg0, arg1 = struct.unpack(
+            "<IBbxxII", bytes.fromhex(child.match.group(1))
+        )
+        # scheduler events may be interleaved
+        if type_ in (t for t, _ in EXPECTED):
+            # recorded by main(), not in interrupt context
+            assert event_pid > 0
+            if type_ == TRACE_EVENT_USER:
+                found.append((type_, arg0, arg1))
+            else:
+                found.append((type_, arg1))
+    assert tuple(found) == EXPECTED, found
+    child.expect_exact("trace_event end")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -18,6 +18,7 @@
 #include "net/ipv6/addr.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6/nib/abr.h"
+#include "net/gnrc/ipv6/nib/rc.h"
 
 #include "_nib-internal.h"
 
@@ -100,12 +101,37 @@ static void test_nib_abr_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_abr_iter(&iter_state, &abr));
 }
 
+/*
+ * Creates an authoritative border router list entry, caches a route and
+ * removes the border router again.
+ * Expected result: the route cache is empty.
+ */
+static void test_nib_abr_del__rc_flushed(void)
+{
+    void *iter_state = NULL;
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_nc_t nce = { .ipv6 = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } },
+                               .l2addr_len = 0 };
+    gnrc_ipv6_nib_rc_t rce;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_abr_add(&addr));
+    _nib_rc_add(&nce.ipv6, 0, &nce);
+    TEST_ASSERT(gnrc_ipv6_nib_rc_iter(&iter_state, &rce));
+    TEST_ASSERT(memcmp(&rce.dst, &nce.ipv6, sizeof(nce.ipv6)) == 0);
+    gnrc_ipv6_nib_abr_del(&addr);
+    iter_state = NULL;
+    TEST_ASSERT(!gnrc_ipv6_nib_rc_iter(&iter_state, &rce));
+}
+
 Test *tests_gnrc_ipv6_nib_abr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_nib_abr_add__ENOMEM),
         new_TestFixture(test_nib_abr_add__success),
         new_TestFixture(test_nib_abr_del__success),
+        new_TestFixture(test_nib_abr_del__rc_flushed),
         /* gnrc_ipv6_nib_abr_iter() is tested during all the tests above */
     };
 
@@ -266,6 +266,46 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_multi(void)
+{
+    static const char long_sequence[] =
+        "RIOT is an open-source microkernel-based operating system, designed"
+        " to match the requirements of Internet of Things (IoT) devices and"
+        " other embedded devices. These requirements include a very low memory"
+        " footprint (on the order of a few kilobytes), high energy efficiency"
+        ", real-time capabilities, communication stacks for both wireless and"
+        " wired networks, and support for a wide range of low-power hardware.";
+    static const char digits_letters[] =
+        "0123456789abcde-0123456789abcde-0123456789abcde-0123456789abcde-";
+    /* more than eight buffers, so both a group of eight and single buffers
+     * are hashed, with complete blocks in common in the group */
+    static const char *teststrings[] = {
+        long_sequence, digits_letters, long_sequence, digits_letters,
+        long_sequence, digits_letters, long_sequence, digits_letters,
+        "abc", "", "Franz jagt im komplett verwahrlosten Taxi quer durch Bayern",
+    };
+    static const unsigned char *expected[] = {
+        hlong_sequence, hdigits_letters, hlong_sequence, hdigits_letters,
+        hlong_sequence, hdigits_letters, hlong_sequence, hdigits_letters,
+        h_fips_oneblock, hempty, hpangramm,
+    };
+    static unsigned char hashes[ARRAY_SIZE(teststrings)][SHA256_DIGEST_LENGTH];
+    const void *data[ARRAY_SIZE(teststrings)];
+    size_t len[ARRAY_SIZE(teststrings)];
+    void *digests[ARRAY_SIZE(teststrings)];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(teststrings); i++) {
+        data[i] = teststrings[i];
+        len[i] = strlen(teststrings[i]);
+        digests[i] = hashes[i];
+    }
+    sha256_multi(data, len, digests, ARRAY_SIZE(teststrings));
+    for (unsigned i = 0; i < ARRAY_SIZE(teststrings); i++) {
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected[i], hashes[i],
+                                        SHA256_DIGEST_LENGTH));
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -284,6 +324,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_multi),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
@@ -13,9 +13,11 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
+#include "kernel_defines.h"
 #include "net/inet_csum.h"
 
 #include "unittests-constants.h"
@@ -165,6 +167,76 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straight-forward byte-wise reference implementation */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++, accum_len++) {
+        csum += (accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _fill(uint8_t *buf, size_t len, uint32_t seed)
+{
+    for (unsigned i = 0; i < len; i++) {
+        /* glibc's LCG parameters */
+        seed = seed * 1103515245 + 12345;
+        buf[i] = seed >> 16;
+    }
+}
+
+static void test_inet_csum__alignment(void)
+{
+    /* 8 byte aligned, so all offsets modulo the largest word size are hit */
+    static uint64_t data[(2 * 67 + 8) / sizeof(uint64_t) + 1];
+    uint8_t *buf = (uint8_t *)data;
+    const uint16_t sums[] = { 0x0000, 0x0001, 0x8000, 0xffff };
+
+    for (unsigned i = 0; i < 2; i++) {
+        /* second round with all bits set to maximize carries */
+        if (i == 0) {
+            _fill(buf, sizeof(data), TEST_UINT32);
+        }
+        else {
+            memset(buf, 0xff, sizeof(data));
+        }
+        for (unsigned offset = 0; offset < 8; offset++) {
+            for (unsigned len = 0; len <= 2 * 67; len++) {
+                for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                    for (unsigned j = 0; j < ARRAY_SIZE(sums); j++) {
+                        TEST_ASSERT_EQUAL_INT(
+                            _ref_csum_slice(sums[j], buf + offset, len, accum_len),
+                            inet_csum_slice(sums[j], buf + offset, len, accum_len)
+                        );
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__slices(void)
+{
+    static uint8_t data[1280U + 1];
+    uint16_t expected;
+
+    _fill(data, sizeof(data), TEST_UINT32);
+    expected = _ref_csum_slice(0, data, sizeof(data), 0);
+    TEST_ASSERT_EQUAL_INT(expected, inet_csum(0, data, sizeof(data)));
+    for (unsigned split = 1; split < 32; split++) {
+        uint16_t sum = inet_csum_slice(0, data, split, 0);
+
+        sum = inet_csum_slice(sum, data + split, sizeof(data) - split, split);
+        TEST_ASSERT_EQUAL_INT(expected, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +248,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignment),
+        new_TestFixture(test_inet_csum__slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
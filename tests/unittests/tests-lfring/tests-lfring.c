@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+#include "kernel_defines.h"
+
+#include "lfring.h"
+#include "tests-lfring.h"
+
+#define TEST_INPUT          (0xdb5a)
+#define BUFFER_SIZE         (8)     /* intentionally not unsigned to easier
+                                     * check for implicit casting problems */
+#define IO_BUFFER_CANARY    (0xb8b8)
+
+static uint16_t _lfring_buffer[BUFFER_SIZE];
+static atomic_uint_least16_t _lfring_seqs[BUFFER_SIZE];
+static uint16_t _io_buffer[BUFFER_SIZE * 2];
+static lfring_t _lfring = LFRING_INIT(_lfring_buffer, sizeof(uint16_t));
+static lfring_mpsc_t _lfring_mpsc;
+
+static void set_up(void)
+{
+    lfring_mpsc_init(&_lfring_mpsc, _lfring_buffer, _lfring_seqs,
+                     sizeof(uint16_t), BUFFER_SIZE);
+}
+
+static void tear_down(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_io_buffer); i++) {
+        _io_buffer[i] = IO_BUFFER_CANARY;
+    }
+    memset(_lfring_buffer, 0, sizeof(_lfring_buffer));
+    lfring_init(&_lfring, _lfring_buffer, sizeof(uint16_t), BUFFER_SIZE);
+}
+
+static void test_init(void)
+{
+    lfring_t lfring;
+
+    lfring_init(&lfring, _lfring_buffer, sizeof(uint16_t), BUFFER_SIZE);
+    TEST_ASSERT(memcmp(&lfring, &_lfring, sizeof(lfring)) == 0);
+}
+
+static void test_empty(void)
+{
+    uint16_t input = TEST_INPUT;
+
+    TEST_ASSERT_EQUAL_INT(1, lfring_empty(&_lfring));
+
+    TEST_ASSERT_EQUAL_INT(0, lfring_put(&_lfring, &input));
+    TEST_ASSERT_EQUAL_INT(0, lfring_empty(&_lfring));
+}
+
+static void test_avail_free(void)
+{
+    uint16_t input = TEST_INPUT;
+
+    TEST_ASSERT_EQUAL_INT(0, lfring_avail(&_lfring));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfring_free(&_lfring));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, lfring_put(&_lfring, &input));
+        TEST_ASSERT_EQUAL_INT(i + 1, lfring_avail(&_lfring));
+        TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - (i + 1), lfring_free(&_lfring));
+    }
+}
+
+static void test_put_get(void)
+{
+    uint16_t output;
+
+    TEST_ASSERT_EQUAL_INT(-1, lfring_get(&_lfring, &output));
+    /* wrap around the buffer a few times */
+    for (int i = 0; i < (4 * BUFFER_SIZE); i++) {
+        uint16_t input = TEST_INPUT + i;
+
+        TEST_ASSERT_EQUAL_INT(0, lfring_put(&_lfring, &input));
+        TEST_ASSERT_EQUAL_INT(0, lfring_get(&_lfring, &output));
+        TEST_ASSERT_EQUAL_INT(input, output);
+        TEST_ASSERT_EQUAL_INT(-1, lfring_get(&_lfring, &output));
+    }
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        uint16_t input = TEST_INPUT + i;
+
+        TEST_ASSERT_EQUAL_INT(0, lfring_put(&_lfring, &input));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, lfring_put(&_lfring, &output));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, lfring_get(&_lfring, &output));
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + i, output);
+    }
+}
+
+static void test_put_get_many(void)
+{
+    uint16_t input[BUFFER_SIZE + 1];
+
+    for (int i = 0; i < (int)ARRAY_SIZE(input); i++) {
+        input[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, lfring_get_many(&_lfring, _io_buffer,
+                                             ARRAY_SIZE(_io_buffer)));
+    /* move positions to the middle of the buffer so the copies wrap around */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2,
+                          lfring_put_many(&_lfring, input, BUFFER_SIZE / 2));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2,
+                          lfring_get_many(&_lfring, _io_buffer,
+                                          ARRAY_SIZE(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          lfring_put_many(&_lfring, input, ARRAY_SIZE(input)));
+    TEST_ASSERT_EQUAL_INT(0, lfring_put_many(&_lfring, input, 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          lfring_get_many(&_lfring, _io_buffer,
+                                          ARRAY_SIZE(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + i, _io_buffer[i]);
+    }
+    for (int i = BUFFER_SIZE; i < (int)ARRAY_SIZE(_io_buffer); i++) {
+        TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[i]);
+    }
+}
+
+static void test_mpsc_put_get(void)
+{
+    uint16_t output;
+
+    TEST_ASSERT_EQUAL_INT(-1, lfring_mpsc_get(&_lfring_mpsc, &output));
+    for (int i = 0; i < (4 * BUFFER_SIZE); i++) {
+        uint16_t input = TEST_INPUT + i;
+
+        TEST_ASSERT_EQUAL_INT(0, lfring_mpsc_put(&_lfring_mpsc, &input));
+        TEST_ASSERT_EQUAL_INT(0, lfring_mpsc_get(&_lfring_mpsc, &output));
+        TEST_ASSERT_EQUAL_INT(input, output);
+        TEST_ASSERT_EQUAL_INT(-1, lfring_mpsc_get(&_lfring_mpsc, &output));
+    }
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        uint16_t input = TEST_INPUT + i;
+
+        TEST_ASSERT_EQUAL_INT(0, lfring_mpsc_put(&_lfring_mpsc, &input));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, lfring_mpsc_put(&_lfring_mpsc, &output));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, lfring_mpsc_get(&_lfring_mpsc, &output));
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + i, output);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, lfring_mpsc_get(&_lfring_mpsc, &output));
+}
+
+static Test *tests_lfring_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_init),
+        new_TestFixture(test_empty),
+        new_TestFixture(test_avail_free),
+        new_TestFixture(test_put_get),
+        new_TestFixture(test_put_get_many),
+        new_TestFixture(test_mpsc_put_get),
+    };
+
+    EMB_UNIT_TESTCALLER(lfring_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&lfring_tests;
+}
+
+void tests_lfring(void)
+{
+    TESTS_RUN(tests_lfring_tests());
+}
+/** @} */
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for lock-free ringbuffer
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef TESTS_LFRING_H
+#define TESTS_LFRING_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Entry point of the test suite
+ */
+void tests_lfring(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_LFRING_H */
+/** @} */
@@ -19,6 +19,7 @@
 
 #include "embUnit.h"
 
+#include "kernel_defines.h"
 #include "net/nanocoap.h"
 
 #include "unittests-constants.h"
@@ -836,6 +837,109 @@ static void test_nanocoap__token_length_over_limit(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
+/* sorted by path, as required by coap_find_resource() */
+static const coap_resource_t _resources[] = {
+    { "/a", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/a/b", COAP_GET, NULL, NULL },
+    { "/a/b/c", COAP_PUT, NULL, NULL },
+    { "/a/b/c", COAP_POST, NULL, NULL },
+    { "/a/bb", COAP_GET, NULL, NULL },
+    { "/ab", COAP_GET | COAP_POST, NULL, NULL },
+    { "/b", COAP_PUT | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/b/c", COAP_GET, NULL, NULL },
+    { "/c", COAP_GET, NULL, NULL },
+};
+
+static int _find(const char *uri, coap_method_flags_t method_flag,
+                 const coap_resource_t **resource)
+{
+    *resource = NULL;
+    return coap_find_resource(_resources, ARRAY_SIZE(_resources),
+                              (const uint8_t *)uri, method_flag, resource);
+}
+
+/*
+ * Verifies coap_find_resource() matches complete paths.
+ */
+static void test_nanocoap__find_resource_exact(void)
+{
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(0, _find("/a", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b/c", COAP_PUT, &resource));
+    TEST_ASSERT(resource == &_resources[2]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b/c", COAP_POST, &resource));
+    TEST_ASSERT(resource == &_resources[3]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/ab", COAP_POST, &resource));
+    TEST_ASSERT(resource == &_resources[5]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/b", COAP_PUT, &resource));
+    TEST_ASSERT(resource == &_resources[6]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/b/c", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[7]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/c", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[8]);
+}
+
+/*
+ * Verifies coap_find_resource() matches prefixes of subtree resources only.
+ */
+static void test_nanocoap__find_resource_subtree(void)
+{
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(0, _find("/aa", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b/d", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b/c/d", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/b/c/d", COAP_PUT, &resource));
+    TEST_ASSERT(resource == &_resources[6]);
+    /* the first matching resource wins */
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/ab", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+    TEST_ASSERT_EQUAL_INT(0, _find("/b/c", COAP_PUT, &resource));
+    TEST_ASSERT(resource == &_resources[6]);
+}
+
+/*
+ * Verifies coap_find_resource() reports matching paths with the wrong method.
+ */
+static void test_nanocoap__find_resource_wrong_method(void)
+{
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _find("/a/b/c", COAP_DELETE, &resource));
+    TEST_ASSERT_NULL(resource);
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _find("/a/bb", COAP_PUT, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _find("/b/c/d", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _find("/c", COAP_POST, &resource));
+    /* subtree resource matches, but not the exact one */
+    TEST_ASSERT_EQUAL_INT(0, _find("/a/b/c", COAP_GET, &resource));
+    TEST_ASSERT(resource == &_resources[0]);
+}
+
+/*
+ * Verifies coap_find_resource() does not match unknown paths.
+ */
+static void test_nanocoap__find_resource_no_path(void)
+{
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _find("/", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _find("/0", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _find("/c/d", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _find("/cc", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _find("/d", COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_find_resource(_resources, 0,
+                                                      (const uint8_t *)"/a",
+                                                      COAP_GET, &resource));
+    TEST_ASSERT_NULL(resource);
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -863,6 +967,10 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__add_path_unterminated_string),
         new_TestFixture(test_nanocoap__add_get_proxy_uri),
         new_TestFixture(test_nanocoap__token_length_over_limit),
+        new_TestFixture(test_nanocoap__find_resource_exact),
+        new_TestFixture(test_nanocoap__find_resource_subtree),
+        new_TestFixture(test_nanocoap__find_resource_wrong_method),
+        new_TestFixture(test_nanocoap__find_resource_no_path),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);